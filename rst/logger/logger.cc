@@ -77,8 +77,8 @@ void Logger::Log(const Level level, const NotNull<const char*> filename,
   }
   RST_DCHECK(level_str != nullptr);
 
-  g_logger->sink_->Log(
-      Format("[{}:{}({})] {}", {level_str, filename, line, message}));
+  static constexpr FormatString kFormat("[{}:{}({})] {}");
+  g_logger->sink_->Log(Format<kFormat>(level_str, filename, line, message));
 
   RST_CHECK(level != Level::kFatal);
 }
@@ -43,6 +43,10 @@
 //   // Android code.
 //   #endif  // RST_BUILDFLAG(OS_ANDROID)
 //
+//   #if RST_BUILDFLAG(OS_LINUX)
+//   // Linux (including Android) code.
+//   #endif  // RST_BUILDFLAG(OS_LINUX)
+//
 #if defined(_WIN32)
 #define RST_BUILDFLAG_OS_WIN() (true)
 #else  // !defined(_WIN32)
@@ -55,4 +59,10 @@
 #define RST_BUILDFLAG_OS_ANDROID() (false)
 #endif  // defined(__ANDROID__)
 
+#if defined(__linux__)
+#define RST_BUILDFLAG_OS_LINUX() (true)
+#else  // !defined(__linux__)
+#define RST_BUILDFLAG_OS_LINUX() (false)
+#endif  // defined(__linux__)
+
 #endif  // RST_MACROS_OS_H_
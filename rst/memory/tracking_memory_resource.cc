@@ -0,0 +1,68 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/memory/tracking_memory_resource.h"
+
+#include "rst/check/check.h"
+
+namespace rst {
+
+TrackingMemoryResource::TrackingMemoryResource(
+    const NotNull<std::pmr::memory_resource*> upstream)
+    : upstream_(*upstream) {}
+
+TrackingMemoryResource::~TrackingMemoryResource() = default;
+
+void* TrackingMemoryResource::do_allocate(const size_t bytes,
+                                          const size_t alignment) {
+  const auto p = upstream_.allocate(bytes, alignment);
+  allocation_count_.fetch_add(1, std::memory_order_relaxed);
+  const auto allocated_bytes =
+      allocated_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+  while (peak_bytes < allocated_bytes &&
+         !peak_bytes_.compare_exchange_weak(peak_bytes, allocated_bytes,
+                                            std::memory_order_relaxed)) {
+  }
+  return p;
+}
+
+void TrackingMemoryResource::do_deallocate(void* const p, const size_t bytes,
+                                           const size_t alignment) {
+  RST_DCHECK(allocation_count() > 0);
+  RST_DCHECK(allocated_bytes() >= bytes);
+  allocation_count_.fetch_sub(1, std::memory_order_relaxed);
+  allocated_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+  upstream_.deallocate(p, bytes, alignment);
+}
+
+bool TrackingMemoryResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace rst
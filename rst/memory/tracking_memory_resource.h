@@ -0,0 +1,89 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_MEMORY_TRACKING_MEMORY_RESOURCE_H_
+#define RST_MEMORY_TRACKING_MEMORY_RESOURCE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+
+namespace rst {
+
+// Memory resource that counts the bytes allocated through it from |upstream|.
+// All methods are thread-safe.
+//
+// Example:
+//
+//   #include "rst/memory/tracking_memory_resource.h"
+//
+//   rst::TrackingMemoryResource resource;
+//   rst::Value value(std::allocator_arg, &resource, rst::Value::Type::kObject);
+//   value.SetKey("key", rst::Value("value"));
+//   size_t bytes = resource.allocated_bytes();
+//
+class TrackingMemoryResource : public std::pmr::memory_resource {
+ public:
+  explicit TrackingMemoryResource(NotNull<std::pmr::memory_resource*> upstream =
+                                      std::pmr::get_default_resource());
+  ~TrackingMemoryResource() override;
+
+  // Returns the number of bytes allocated and not yet deallocated.
+  size_t allocated_bytes() const {
+    return allocated_bytes_.load(std::memory_order_relaxed);
+  }
+  // Returns the maximum of allocated_bytes() so far.
+  size_t peak_bytes() const {
+    return peak_bytes_.load(std::memory_order_relaxed);
+  }
+  // Returns the number of allocations not yet deallocated.
+  size_t allocation_count() const {
+    return allocation_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // std::pmr::memory_resource:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+  std::pmr::memory_resource& upstream_;
+
+  std::atomic<size_t> allocated_bytes_ = 0;
+  std::atomic<size_t> peak_bytes_ = 0;
+  std::atomic<size_t> allocation_count_ = 0;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(TrackingMemoryResource);
+};
+
+}  // namespace rst
+
+#endif  // RST_MEMORY_TRACKING_MEMORY_RESOURCE_H_
@@ -0,0 +1,72 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/memory/tracking_memory_resource.h"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace rst {
+
+TEST(TrackingMemoryResource, CountsAllocations) {
+  TrackingMemoryResource resource;
+  EXPECT_EQ(resource.allocated_bytes(), 0U);
+  EXPECT_EQ(resource.peak_bytes(), 0U);
+  EXPECT_EQ(resource.allocation_count(), 0U);
+
+  {
+    std::pmr::vector<int> vector(&resource);
+    vector.reserve(10);
+    EXPECT_EQ(resource.allocated_bytes(), 10 * sizeof(int));
+    EXPECT_EQ(resource.allocation_count(), 1U);
+
+    std::pmr::string string(100, 'a', &resource);
+    EXPECT_EQ(resource.allocated_bytes(), 10 * sizeof(int) + 101);
+    EXPECT_EQ(resource.allocation_count(), 2U);
+  }
+
+  EXPECT_EQ(resource.allocated_bytes(), 0U);
+  EXPECT_EQ(resource.peak_bytes(), 10 * sizeof(int) + 101);
+  EXPECT_EQ(resource.allocation_count(), 0U);
+}
+
+TEST(TrackingMemoryResource, Upstream) {
+  TrackingMemoryResource upstream;
+  TrackingMemoryResource resource(&upstream);
+
+  std::pmr::vector<char> vector(&resource);
+  vector.reserve(16);
+  EXPECT_EQ(resource.allocated_bytes(), 16U);
+  EXPECT_EQ(upstream.allocated_bytes(), 16U);
+  EXPECT_TRUE(resource.is_equal(resource));
+  EXPECT_FALSE(resource.is_equal(upstream));
+}
+
+}  // namespace rst
@@ -39,6 +39,11 @@ Nullable<const Value*> MemoryPreferencesStore::GetValue(
   return values_.FindPath(path);
 }
 
+Nullable<const Value*> MemoryPreferencesStore::FindValue(
+    const Value::Path& path) const {
+  return values_.FindPath(path);
+}
+
 void MemoryPreferencesStore::SetValue(const std::string_view path,
                                       Value&& value) {
   values_.SetPath(path, std::move(value));
@@ -43,6 +43,7 @@ class MemoryPreferencesStore final : public PreferencesStore {
 
   // PreferencesStore:
   Nullable<const Value*> GetValue(std::string_view path) const override;
+  Nullable<const Value*> FindValue(const Value::Path& path) const override;
   void SetValue(std::string_view path, Value&& value) override;
 
  private:
@@ -83,8 +83,8 @@ class Preferences {
     RegisterPreference(std::move(path), Value(default_value));
   }
   void RegisterStringPreference(std::string&& path,
-                                Value::String&& default_value) {
-    RegisterPreference(std::move(path), Value(std::move(default_value)));
+                                std::string_view default_value) {
+    RegisterPreference(std::move(path), Value(default_value));
   }
   void RegisterArrayPreference(std::string&& path,
                                Value::Array&& default_value) {
@@ -115,8 +115,8 @@ class Preferences {
   void SetDouble(std::string_view path, double value) {
     SetValue(path, Value(value));
   }
-  void SetString(std::string_view path, Value::String&& value) {
-    SetValue(path, Value(std::move(value)));
+  void SetString(std::string_view path, std::string_view value) {
+    SetValue(path, Value(value));
   }
   void SetArray(std::string_view path, Value::Array&& value) {
     SetValue(path, Value(std::move(value)));
@@ -31,4 +31,9 @@ namespace rst {
 
 PreferencesStore::~PreferencesStore() = default;
 
+Nullable<const Value*> PreferencesStore::FindValue(
+    const Value::Path& path) const {
+  return GetValue(path.path());
+}
+
 }  // namespace rst
@@ -45,6 +45,9 @@ class PreferencesStore {
 
   // Returns a value for a given preference |path|.
   virtual Nullable<const Value*> GetValue(std::string_view path) const = 0;
+  // Returns a value for a given preference |path| that is split in advance.
+  // Looks up the dotted path with GetValue() by default.
+  virtual Nullable<const Value*> FindValue(const Value::Path& path) const;
   // Sets a |value| for a |path| in the store.
   virtual void SetValue(std::string_view path, Value&& value) = 0;
 };
@@ -27,6 +27,7 @@
 
 #include "rst/preferences/preferences.h"
 
+#include <string>
 #include <utility>
 
 #include <gmock/gmock.h>
@@ -199,6 +200,15 @@ TEST_F(PreferencesTest, SetValues) {
   prefs_.SetString("string", "World");
   testing::Mock::VerifyAndClearExpectations(pref_store_.get());
 
+  EXPECT_CALL(*pref_store_, SetValue(_, _))
+      .WillOnce([](const std::string_view path, Value&& value) {
+        EXPECT_EQ(path, "string");
+        EXPECT_EQ(value, Value("std::string"));
+      });
+  const std::string str = "std::string";
+  prefs_.SetString("string", str);
+  testing::Mock::VerifyAndClearExpectations(pref_store_.get());
+
   Value::Array array;
   array.emplace_back("b");
   array.emplace_back(2);
@@ -340,4 +350,28 @@ TEST_F(MemoryPreferencesStoreTest, MemoryPreferencesStore) {
   EXPECT_EQ(*value, Value(20));
 }
 
+TEST_F(MemoryPreferencesStoreTest, FindValue) {
+  MemoryPreferencesStore pref_store;
+
+  const Value::Path path("path.path2");
+  auto value = pref_store.FindValue(path);
+  EXPECT_EQ(value, nullptr);
+
+  pref_store.SetValue("path.path2", Value(20));
+  value = pref_store.FindValue(path);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*value, Value(20));
+
+  EXPECT_EQ(pref_store.FindValue(Value::Path("path")),
+            pref_store.GetValue("path"));
+}
+
+TEST(PreferencesStore, FindValue) {
+  MockPreferencesStore pref_store;
+  const Value value(10);
+  EXPECT_CALL(pref_store, GetValue(std::string_view("path.path2")))
+      .WillOnce(Return(&value));
+  EXPECT_EQ(pref_store.FindValue(Value::Path("path.path2")), &value);
+}
+
 }  // namespace rst
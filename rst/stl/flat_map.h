@@ -0,0 +1,283 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_STL_FLAT_MAP_H_
+#define RST_STL_FLAT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "rst/stl/algorithm.h"
+
+namespace rst {
+
+// An associative container with a `std::map`-like interface that keeps its
+// elements in a vector sorted by key. Lookups are binary searches over
+// contiguous memory, which is several times faster than `std::map` for small
+// maps, and the map makes one allocation instead of one per key.
+//
+// Insertion and erasure are O(n) except at the end, so build large maps from
+// an unsorted vector with the constructor that sorts it once. Unlike
+// `std::map`, insertion and erasure invalidate iterators and references, and
+// keys must not be modified through iterators. |Compare| must be stateless.
+//
+// Example:
+//
+//   #include "rst/stl/flat_map.h"
+//
+//   rst::FlatMap<std::string, int> map;
+//   map.emplace("key", 1);
+//   auto it = map.find("key");
+//
+template <class Key, class T, class Compare = std::less<>,
+          class Allocator = std::allocator<std::pair<Key, T>>>
+class FlatMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using container_type = std::vector<value_type, Allocator>;
+  using size_type = typename container_type::size_type;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+
+  FlatMap() = default;
+  explicit FlatMap(const Allocator& allocator) : data_(allocator) {}
+  // Takes unsorted |data|. Of equal keys the last one wins.
+  explicit FlatMap(container_type&& data) : data_(std::move(data)) {
+    SortAndRemoveDuplicates();
+  }
+  FlatMap(const FlatMap&) = default;
+  FlatMap(FlatMap&&) noexcept = default;
+  // Allocator-extended constructors.
+  FlatMap(const FlatMap& other, const Allocator& allocator)
+      : data_(other.data_, allocator) {}
+  FlatMap(FlatMap&& other, const Allocator& allocator)
+      : data_(std::move(other.data_), allocator) {}
+
+  ~FlatMap() = default;
+
+  FlatMap& operator=(const FlatMap&) = default;
+  FlatMap& operator=(FlatMap&&) noexcept = default;
+
+  allocator_type get_allocator() const { return data_.get_allocator(); }
+
+  iterator begin() { return data_.begin(); }
+  const_iterator begin() const { return data_.begin(); }
+  const_iterator cbegin() const { return data_.cbegin(); }
+  iterator end() { return data_.end(); }
+  const_iterator end() const { return data_.end(); }
+  const_iterator cend() const { return data_.cend(); }
+
+  bool empty() const { return data_.empty(); }
+  size_type size() const { return data_.size(); }
+  size_type capacity() const { return data_.capacity(); }
+  void reserve(const size_type size) { data_.reserve(size); }
+  void clear() { data_.clear(); }
+
+  template <class K>
+  iterator lower_bound(const K& key) {
+    return std::lower_bound(data_.begin(), data_.end(), key, KeyLess());
+  }
+  template <class K>
+  const_iterator lower_bound(const K& key) const {
+    return std::lower_bound(data_.begin(), data_.end(), key, KeyLess());
+  }
+
+  template <class K>
+  iterator find(const K& key) {
+    const auto it = lower_bound(key);
+    if (it == data_.end() || Compare()(key, it->first))
+      return data_.end();
+    return it;
+  }
+  template <class K>
+  const_iterator find(const K& key) const {
+    const auto it = lower_bound(key);
+    if (it == data_.cend() || Compare()(key, it->first))
+      return data_.cend();
+    return it;
+  }
+
+  template <class K>
+  size_type count(const K& key) const {
+    return find(key) == data_.cend() ? 0 : 1;
+  }
+
+  // Returns the element with |key|, inserts a default constructed one if there
+  // is no such element.
+  template <class K>
+  T& operator[](K&& key) {
+    return try_emplace(std::forward<K>(key)).first->second;
+  }
+
+  // Inserts an element constructed from |key| and |args| if there is no
+  // element with |key|.
+  template <class K, class... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+    const auto it = lower_bound(key);
+    if (it != data_.end() && !Compare()(key, it->first))
+      return {it, false};
+
+    return {Insert(it, std::forward<K>(key), std::forward<Args>(args)...),
+            true};
+  }
+
+  // Like the function above but inserts in amortized O(1) if the element
+  // should be inserted just before |hint|.
+  template <class K, class... Args>
+  iterator try_emplace(const const_iterator hint, K&& key, Args&&... args) {
+    if (IsInsertionPoint(hint, key)) {
+      return Insert(data_.begin() + (hint - data_.cbegin()),
+                    std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    return try_emplace(std::forward<K>(key), std::forward<Args>(args)...)
+        .first;
+  }
+
+  template <class K, class... Args>
+  std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+    return try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+  }
+
+  template <class K, class... Args>
+  iterator emplace_hint(const const_iterator hint, K&& key, Args&&... args) {
+    return try_emplace(hint, std::forward<K>(key), std::forward<Args>(args)...);
+  }
+
+  // Inserts an element or assigns |value| to the element with |key|.
+  template <class K, class M>
+  std::pair<iterator, bool> insert_or_assign(K&& key, M&& value) {
+    const auto [it, inserted] =
+        try_emplace(std::forward<K>(key), std::forward<M>(value));
+    if (!inserted)
+      it->second = std::forward<M>(value);
+    return {it, inserted};
+  }
+
+  template <class K, class M>
+  iterator insert_or_assign(const const_iterator hint, K&& key, M&& value) {
+    if (IsInsertionPoint(hint, key)) {
+      return Insert(data_.begin() + (hint - data_.cbegin()),
+                    std::forward<K>(key), std::forward<M>(value));
+    }
+
+    return insert_or_assign(std::forward<K>(key), std::forward<M>(value))
+        .first;
+  }
+
+  iterator erase(const iterator it) { return data_.erase(it); }
+  iterator erase(const const_iterator it) { return data_.erase(it); }
+
+  template <class K>
+  size_type erase(const K& key) {
+    const auto it = find(key);
+    if (it == data_.end())
+      return 0;
+
+    data_.erase(it);
+    return 1;
+  }
+
+  friend bool operator==(const FlatMap& lhs, const FlatMap& rhs) {
+    return lhs.data_ == rhs.data_;
+  }
+  friend bool operator!=(const FlatMap& lhs, const FlatMap& rhs) {
+    return !(lhs == rhs);
+  }
+  friend bool operator<(const FlatMap& lhs, const FlatMap& rhs) {
+    return lhs.data_ < rhs.data_;
+  }
+
+ private:
+  // Compares elements with keys.
+  struct KeyLess {
+    template <class K>
+    bool operator()(const value_type& element, const K& key) const {
+      return Compare()(element.first, key);
+    }
+  };
+
+  template <class K>
+  bool IsInsertionPoint(const const_iterator hint, const K& key) const {
+    return (hint == data_.cbegin() || Compare()((hint - 1)->first, key)) &&
+           (hint == data_.cend() || Compare()(key, hint->first));
+  }
+
+  template <class K, class... Args>
+  iterator Insert(const const_iterator position, K&& key, Args&&... args) {
+    return data_.emplace(
+        position, std::piecewise_construct,
+        std::forward_as_tuple(std::forward<K>(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  void SortAndRemoveDuplicates() {
+    const auto less = [](const value_type& lhs, const value_type& rhs) {
+      return Compare()(lhs.first, rhs.first);
+    };
+
+    // Input that is already sorted without duplicates is common.
+    if (std::adjacent_find(data_.cbegin(), data_.cend(),
+                           [&less](const value_type& lhs,
+                                   const value_type& rhs) {
+                             return !less(lhs, rhs);
+                           }) == data_.cend()) {
+      return;
+    }
+
+    c_stable_sort(data_, less);
+
+    // Keeps the last element of each range of equal keys.
+    auto out = data_.begin();
+    for (auto it = data_.begin(); it != data_.end(); ++out) {
+      auto next = it + 1;
+      while (next != data_.end() && !less(*it, *next))
+        it = next++;
+
+      if (out != it)
+        *out = std::move(*it);
+      it = next;
+    }
+
+    data_.erase(out, data_.end());
+  }
+
+  container_type data_;
+};
+
+}  // namespace rst
+
+#endif  // RST_STL_FLAT_MAP_H_
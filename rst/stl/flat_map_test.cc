@@ -0,0 +1,158 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/stl/flat_map.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace rst {
+namespace {
+
+using Map = FlatMap<std::string, int>;
+
+std::vector<std::pair<std::string, int>> Elements(const Map& map) {
+  return std::vector<std::pair<std::string, int>>(map.begin(), map.end());
+}
+
+}  // namespace
+
+TEST(FlatMap, Empty) {
+  const Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0U);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find("key"), map.end());
+}
+
+TEST(FlatMap, Emplace) {
+  Map map;
+  EXPECT_TRUE(map.emplace("b", 2).second);
+  EXPECT_TRUE(map.emplace("c", 3).second);
+  EXPECT_TRUE(map.emplace("a", 1).second);
+
+  const auto [it, inserted] = map.emplace("b", 20);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, 2);
+
+  EXPECT_EQ(Elements(map),
+            (std::vector<std::pair<std::string, int>>{
+                {"a", 1}, {"b", 2}, {"c", 3}}));
+}
+
+TEST(FlatMap, Find) {
+  Map map;
+  map.emplace("b", 2);
+  map.emplace("a", 1);
+
+  EXPECT_EQ(map.find(std::string_view("a"))->second, 1);
+  EXPECT_EQ(map.find("b")->second, 2);
+  EXPECT_EQ(map.find(std::string("c")), map.end());
+  EXPECT_EQ(std::as_const(map).find("0"), map.cend());
+  EXPECT_EQ(map.count("a"), 1U);
+  EXPECT_EQ(map.count("c"), 0U);
+}
+
+TEST(FlatMap, TryEmplaceWithHint) {
+  Map map;
+  for (auto i = 0; i < 10; i++)
+    map.try_emplace(map.cend(), std::to_string(i), i);
+  map.try_emplace(map.cbegin(), "5", 50);
+  map.try_emplace(map.cend(), "55", 55);
+  map.emplace_hint(map.cbegin(), "00", 0);
+
+  ASSERT_EQ(map.size(), 12U);
+  EXPECT_EQ(map.find("5")->second, 5);
+  EXPECT_EQ(map.find("55")->second, 55);
+  EXPECT_EQ(map.begin()->first, "0");
+  EXPECT_EQ((map.begin() + 1)->first, "00");
+}
+
+TEST(FlatMap, InsertOrAssign) {
+  Map map;
+  EXPECT_TRUE(map.insert_or_assign("a", 1).second);
+  EXPECT_FALSE(map.insert_or_assign("a", 10).second);
+  map.insert_or_assign(map.cend(), "b", 2);
+  map.insert_or_assign(map.cend(), "a", 100);
+  map["c"] = 3;
+  map["b"]++;
+
+  EXPECT_EQ(Elements(map),
+            (std::vector<std::pair<std::string, int>>{
+                {"a", 100}, {"b", 3}, {"c", 3}}));
+}
+
+TEST(FlatMap, Erase) {
+  Map map;
+  map.emplace("a", 1);
+  map.emplace("b", 2);
+  map.emplace("c", 3);
+
+  EXPECT_EQ(map.erase("b"), 1U);
+  EXPECT_EQ(map.erase("b"), 0U);
+  const auto it = map.erase(map.begin());
+  EXPECT_EQ(it->first, "c");
+  EXPECT_EQ(map.size(), 1U);
+}
+
+TEST(FlatMap, ConstructFromUnsorted) {
+  std::vector<std::pair<std::string, int>> data = {
+      {"c", 3}, {"a", 1}, {"b", 2}, {"a", 10}, {"c", 30}, {"a", 100}};
+  const Map map(std::move(data));
+  EXPECT_EQ(Elements(map),
+            (std::vector<std::pair<std::string, int>>{
+                {"a", 100}, {"b", 2}, {"c", 30}}));
+
+  std::vector<std::pair<std::string, int>> sorted = {{"a", 1}, {"b", 2}};
+  EXPECT_EQ(Elements(Map(std::move(sorted))),
+            (std::vector<std::pair<std::string, int>>{{"a", 1}, {"b", 2}}));
+}
+
+TEST(FlatMap, MoveOnly) {
+  FlatMap<std::string, std::unique_ptr<int>> map;
+  map.emplace("a", std::make_unique<int>(1));
+  map.insert_or_assign("a", std::make_unique<int>(2));
+  EXPECT_EQ(*map.find("a")->second, 2);
+}
+
+TEST(FlatMap, Compare) {
+  Map lhs, rhs;
+  lhs.emplace("a", 1);
+  rhs.emplace("a", 1);
+  EXPECT_EQ(lhs, rhs);
+
+  rhs.emplace("b", 2);
+  EXPECT_NE(lhs, rhs);
+  EXPECT_LT(lhs, rhs);
+}
+
+}  // namespace rst
@@ -28,9 +28,11 @@
 #ifndef RST_STRINGS_ARG_H_
 #define RST_STRINGS_ARG_H_
 
+#include <algorithm>
 #include <charconv>
 #include <cstddef>
-#include <cstdio>
+#include <functional>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -42,23 +44,15 @@
 namespace rst {
 namespace internal {
 
+// Writes the shortest representation of |val| that parses back to the same
+// value, in fixed or scientific notation, whichever is shorter. Doesn't depend
+// on the locale.
 template <class Float, size_t N>
-std::string_view FloatToString(char (&str)[N],
-                               const NotNull<const char*> format,
-                               const Float val) {
+std::string_view FloatToString(char (&str)[N], const Float val) {
   static_assert(std::is_floating_point_v<Float>);
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wformat-nonliteral"
-#pragma warning(push)
-#pragma warning(disable : 4774)
-  // NOLINTNEXTLINE(runtime/printf)
-  const auto bytes_written = std::sprintf(str, format.get(), val);
-#pragma warning(pop)
-#pragma clang diagnostic pop
-  RST_DCHECK(bytes_written > 0);
-  RST_DCHECK(static_cast<size_t>(bytes_written) < N);
-  RST_DCHECK(str[bytes_written] == '\0');
-  return std::string_view(str, static_cast<size_t>(bytes_written));
+  const auto result = std::to_chars(str, str + N, val);
+  RST_DCHECK(result.ec == std::errc());
+  return std::string_view(str, static_cast<size_t>(result.ptr - str));
 }
 
 template <class Int, size_t N>
@@ -70,7 +64,13 @@ std::string_view IntToString(char (&str)[N], const Int val) {
 
 class Arg {
  public:
-  static constexpr size_t kBufferSize = 20;
+  // Fits 2^64 - 1 and the shortest representation of a long double: a sign,
+  // max_digits10 digits, a point and an exponent of up to four digits, e.g.
+  // -3.3621031431120935063e-4932 for the x87 80-bit format.
+  static constexpr size_t kBufferSize =
+      std::max(size_t{20},
+               size_t{std::numeric_limits<long double>::max_digits10 + 8});
+  static_assert(std::numeric_limits<long double>::max_exponent10 < 10000);
 
   // NOLINTNEXTLINE(runtime/explicit)
   Arg(const bool value) : view_(value ? "true" : "false") {}
@@ -101,13 +101,13 @@ class Arg {
   Arg(const unsigned long long value) : view_(IntToString(buffer_, value)) {}
 
   // NOLINTNEXTLINE(runtime/explicit)
-  Arg(const float value) : Arg(static_cast<double>(value)) {}
+  Arg(const float value) : view_(FloatToString(buffer_, value)) {}
 
   // NOLINTNEXTLINE(runtime/explicit)
-  Arg(const double value) : view_(FloatToString(buffer_, "%g", value)) {}
+  Arg(const double value) : view_(FloatToString(buffer_, value)) {}
 
   // NOLINTNEXTLINE(runtime/explicit)
-  Arg(const long double value) : view_(FloatToString(buffer_, "%Lg", value)) {}
+  Arg(const long double value) : view_(FloatToString(buffer_, value)) {}
 
   // NOLINTNEXTLINE(runtime/explicit)
   Arg(const std::string_view value) : view_(value) {}
@@ -132,10 +132,17 @@ class Arg {
   std::string_view view() const { return view_; }
   size_t size() const { return view_.size(); }
 
+  // Returns true if the argument views a part of |string|, so appending to
+  // |string| could invalidate it.
+  bool IsWithin(const std::string_view string) const {
+    const std::less<const char*> less;
+    return !view_.empty() && !less(view_.data(), string.data()) &&
+           less(view_.data(), string.data() + string.size());
+  }
+
  private:
   const std::string_view view_;
-  char buffer_[kBufferSize];  // Can store 2^64 - 1 that is
-                              // 18,446,744,073,709,551,615 (without '\0').
+  char buffer_[kBufferSize];  // Without '\0'.
 
   RST_DISALLOW_COPY_AND_ASSIGN(Arg);
 };
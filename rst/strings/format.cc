@@ -36,26 +36,29 @@
 namespace rst {
 namespace internal {
 
-std::string FormatAndReturnString(const NotNull<const char*> not_null_format,
-                                  const size_t format_size,
-                                  const Nullable<const Arg*> values,
-                                  const size_t size) {
+void FormatAndAppendString(const NotNull<std::string*> output,
+                           const NotNull<const char*> not_null_format,
+                           const size_t format_size,
+                           const Nullable<const Arg*> values,
+                           const size_t size) {
   auto format = not_null_format.get();
 
   RST_DCHECK(format_size == std::strlen(format));
   auto new_size = format_size;
   for (size_t i = 0; i < size; i++) {
     RST_DCHECK(values != nullptr);
+    RST_DCHECK(!values[i].IsWithin(*output) &&
+               "Values must not refer to output");
     new_size += values[i].size();
   }
   RST_DCHECK(new_size >= size * 2);
   new_size -= size * 2;
 
-  std::string output;
-  StringResizeUninitialized(&output, new_size);
+  const auto old_size = output->size();
+  StringResizeUninitialized(output, old_size + new_size);
 
   size_t arg_idx = 0;
-  auto target = output.data();
+  auto target = output->data() + old_size;
   for (auto c = '\0'; (c = *format) != '\0'; format++) {
     switch (RST_LIKELY_EQ(c, ' ')) {
       case '{': {
@@ -88,9 +91,45 @@ std::string FormatAndReturnString(const NotNull<const char*> not_null_format,
 
   RST_DCHECK(arg_idx == size && "Numbers of parameters should match");
 
-  output.resize(static_cast<size_t>(target - output.data()));
-  return output;
+  output->resize(static_cast<size_t>(target - output->data()));
 }
 
+void FormatParsedAndAppendString(const NotNull<std::string*> output,
+                                 const std::string_view text,
+                                 const NotNull<const size_t*> offsets,
+                                 const NotNull<const Arg*> values,
+                                 const size_t size) {
+  auto new_size = text.size();
+  for (size_t i = 0; i < size; i++) {
+    RST_DCHECK(!values.get()[i].IsWithin(*output) &&
+               "Values must not refer to output");
+    new_size += values.get()[i].size();
+  }
+
+  const auto old_size = output->size();
+  StringResizeUninitialized(output, old_size + new_size);
+
+  auto target = output->data() + old_size;
+  size_t begin = 0;
+  for (size_t i = 0; i < size; i++) {
+    const auto end = offsets.get()[i];
+    RST_DCHECK(begin <= end && end <= text.size());
+    std::memcpy(target, text.data() + begin, end - begin);
+    target += end - begin;
+    begin = end;
+
+    if (const auto src = values.get()[i].view(); !src.empty()) {
+      std::memcpy(target, src.data(), src.size());
+      target += src.size();
+    }
+  }
+
+  std::memcpy(target, text.data() + begin, text.size() - begin);
+  target += text.size() - begin;
+  RST_DCHECK(target == output->data() + output->size());
+}
+
+void InvalidFormatString() { RST_DCHECK(false && "Invalid format string"); }
+
 }  // namespace internal
 }  // namespace rst
@@ -31,6 +31,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <string>
+#include <string_view>
 
 #include "rst/not_null/not_null.h"
 #include "rst/strings/arg.h"
@@ -38,9 +39,19 @@
 namespace rst {
 namespace internal {
 
-std::string FormatAndReturnString(NotNull<const char*> format,
-                                  size_t format_size,
-                                  Nullable<const Arg*> values, size_t size);
+void FormatAndAppendString(NotNull<std::string*> output,
+                           NotNull<const char*> format, size_t format_size,
+                           Nullable<const Arg*> values, size_t size);
+
+// Appends |text| with |values| inserted at |offsets| to |output|.
+void FormatParsedAndAppendString(NotNull<std::string*> output,
+                                 std::string_view text,
+                                 NotNull<const size_t*> offsets,
+                                 NotNull<const Arg*> values, size_t size);
+
+// Isn't constexpr, so calling it stops the compile-time parsing with an error.
+void InvalidFormatString();
+
 }  // namespace internal
 
 // This function is for efficiently performing string formatting.
@@ -71,8 +82,8 @@ std::string FormatAndReturnString(NotNull<const char*> format,
 //   * `std::string_view`, `std::string`, `const char*`
 //   * `short`, `unsigned short`, `int`, `unsigned int`, `long`,
 //     `unsigned long`, `long long`, `unsigned long long`
-//   * `float`, `double`, `long double` (printed as if %g is specified for
-//     `printf()`)
+//   * `float`, `double`, `long double` (printed in the shortest form that
+//     parses back to the same value like `std::to_chars()`)
 //   * `bool` (printed as "true" or "false")
 //   * `char`
 //   * `enum`s (printed as underlying integer type)
@@ -81,14 +92,114 @@ std::string FormatAndReturnString(NotNull<const char*> format,
 // build.
 template <size_t N>
 std::string Format(const char (&format)[N]) {
-  return internal::FormatAndReturnString(format, N - 1, nullptr, 0);
+  std::string output;
+  internal::FormatAndAppendString(&output, format, N - 1, nullptr, 0);
+  return output;
 }
 
 template <size_t N>
 std::string Format(const char (&format)[N],
                    const std::initializer_list<internal::Arg> values) {
-  return internal::FormatAndReturnString(format, N - 1, values.begin(),
-                                         values.size());
+  std::string output;
+  internal::FormatAndAppendString(&output, format, N - 1, values.begin(),
+                                  values.size());
+  return output;
+}
+
+// Like `rst::Format()` but appends the result to |output|. The size of the
+// result is computed first, so |output| grows at most once and doesn't
+// allocate if its capacity suffices. |values| must not refer to |output|.
+//
+// Example:
+//
+//   #include "rst/strings/format.h"
+//
+//   std::string s = "Receipt: ";
+//   rst::FormatTo(&s, "{} purchased {} {}", {"Bob", 5, "Apples"});
+//   RST_DCHECK(s == "Receipt: Bob purchased 5 Apples");
+//
+template <size_t N>
+void FormatTo(const NotNull<std::string*> output, const char (&format)[N]) {
+  internal::FormatAndAppendString(output, format, N - 1, nullptr, 0);
+}
+
+template <size_t N>
+void FormatTo(const NotNull<std::string*> output, const char (&format)[N],
+              const std::initializer_list<internal::Arg> values) {
+  internal::FormatAndAppendString(output, format, N - 1, values.begin(),
+                                  values.size());
+}
+
+// A format string for `rst::Format()` parsed at compile time into the text
+// without the escapes and the offsets of the placeholders in it. An invalid
+// format string is a compile error.
+//
+// Example:
+//
+//   #include "rst/strings/format.h"
+//
+//   static constexpr rst::FormatString kFormat("{} purchased {} {}");
+//   std::string s = rst::Format<kFormat>("Bob", 5, "Apples");
+//   RST_DCHECK(s == "Bob purchased 5 Apples");
+//
+template <size_t N>
+class FormatString {
+ public:
+  constexpr explicit FormatString(const char (&format)[N]) {
+    for (size_t i = 0; i + 1 < N; i++) {
+      const auto c = format[i];
+      const auto next = i + 2 < N ? format[i + 1] : '\0';
+      if (c == '{' && next == '}') {
+        offsets_[arg_count_++] = text_size_;
+        i++;
+      } else if (c == '{' || c == '}') {
+        // Unmatched '{' or '}'.
+        if (next != c)
+          internal::InvalidFormatString();
+        text_[text_size_++] = c;
+        i++;
+      } else {
+        text_[text_size_++] = c;
+      }
+    }
+  }
+
+  constexpr std::string_view text() const {
+    return std::string_view(text_, text_size_);
+  }
+  constexpr size_t arg_count() const { return arg_count_; }
+  // Offsets of the placeholders in text().
+  constexpr const size_t* offsets() const { return offsets_; }
+
+ private:
+  char text_[N] = {};
+  size_t offsets_[N] = {};
+  size_t text_size_ = 0;
+  size_t arg_count_ = 0;
+};
+
+// Formats the arguments with |kFormat| that is a constexpr `rst::FormatString`
+// with static storage duration. The number of arguments is checked at compile
+// time, and formatting only copies the precomputed text and the arguments.
+// `rst::FormatTo()` appends the result to |output|.
+template <const auto& kFormat, class... Args>
+void FormatTo(const NotNull<std::string*> output, const Args&... args) {
+  static_assert(sizeof...(Args) == kFormat.arg_count(),
+                "Numbers of parameters should match");
+  if constexpr (sizeof...(Args) == 0) {
+    output->append(kFormat.text());
+  } else {
+    const internal::Arg values[] = {args...};
+    internal::FormatParsedAndAppendString(
+        output, kFormat.text(), kFormat.offsets(), values, sizeof...(Args));
+  }
+}
+
+template <const auto& kFormat, class... Args>
+std::string Format(const Args&... args) {
+  std::string output;
+  FormatTo<kFormat>(&output, args...);
+  return output;
 }
 
 }  // namespace rst
@@ -27,17 +27,32 @@
 
 #include "rst/strings/format.h"
 
+#include <charconv>
 #include <cstdint>
 #include <limits>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 #include <gtest/gtest.h>
 
+#include "rst/check/check.h"
 #include "rst/not_null/not_null.h"
 
 namespace rst {
+namespace {
+
+// Returns the shortest representation of |value| on this platform.
+template <class Float>
+std::string ToChars(const Float value) {
+  char buffer[64];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  RST_CHECK(result.ec == std::errc());
+  return std::string(buffer, result.ptr);
+}
+
+}  // namespace
 
 TEST(Format, Escape) {
   EXPECT_EQ(Format("{{"), "{");
@@ -214,20 +229,17 @@ TEST(Format, MinMax) {
       std::numeric_limits<unsigned long long>::max());  // NOLINT(runtime/int)
   result += ' ';
 
-  std::ostringstream stream;
-  stream << std::numeric_limits<float>::min();
-  stream << ' ';
-  stream << std::numeric_limits<float>::max();
-  stream << ' ';
-  stream << std::numeric_limits<double>::min();
-  stream << ' ';
-  stream << std::numeric_limits<double>::max();
-  stream << ' ';
-  stream << std::numeric_limits<long double>::min();
-  stream << ' ';
-  stream << std::numeric_limits<long double>::max();
-
-  result += stream.str();
+  result += ToChars(std::numeric_limits<float>::min());
+  result += ' ';
+  result += ToChars(std::numeric_limits<float>::max());
+  result += ' ';
+  result += ToChars(std::numeric_limits<double>::min());
+  result += ' ';
+  result += ToChars(std::numeric_limits<double>::max());
+  result += ' ';
+  result += ToChars(std::numeric_limits<long double>::min());
+  result += ' ';
+  result += ToChars(std::numeric_limits<long double>::max());
 
   EXPECT_EQ(string, result);
 }
@@ -312,6 +324,12 @@ TEST(Format, Doubles) {
   }
 }
 
+TEST(Format, ShortestDoubles) {
+  EXPECT_EQ(Format("{} {} {}", {0.1, 1.23f, 2.5L}), "0.1 1.23 2.5");
+  EXPECT_EQ(Format("{}", {1234567.0}), "1234567");
+  EXPECT_EQ(Format("{}", {3.141592653589793}), "3.141592653589793");
+}
+
 TEST(Format, Enum) {
   enum Old {
     kZero,
@@ -345,4 +363,78 @@ TEST(Format, NotNullStr) {
   EXPECT_EQ(Format("{}", {NotNull(kStr)}), kStr);
 }
 
+TEST(Format, FormatTo) {
+  std::string string = "Receipt: ";
+  FormatTo(&string, "{} purchased {} {}", {"Bob", 5, "Apples"});
+  EXPECT_EQ(string, "Receipt: Bob purchased 5 Apples");
+  FormatTo(&string, " {{}}");
+  EXPECT_EQ(string, "Receipt: Bob purchased 5 Apples {}");
+
+  static constexpr FormatString kFormat(" [{}:{}]");
+  FormatTo<kFormat>(&string, "file", 10);
+  EXPECT_EQ(string, "Receipt: Bob purchased 5 Apples {} [file:10]");
+
+  static constexpr FormatString kNoArgs("!");
+  FormatTo<kNoArgs>(&string);
+  EXPECT_EQ(string, "Receipt: Bob purchased 5 Apples {} [file:10]!");
+}
+
+TEST(Format, FormatToReusesCapacity) {
+  std::string string;
+  string.reserve(100);
+  const auto data = string.data();
+  static constexpr FormatString kFormat("{}: {}");
+  for (auto i = 0; i < 10; i++) {
+    string.clear();
+    FormatTo(&string, "record {}: {}", {i, std::string(50, 'a')});
+    EXPECT_EQ(string.data(), data);
+    FormatTo<kFormat>(&string, i, "b");
+    EXPECT_EQ(string.data(), data);
+  }
+}
+
+TEST(Format, FormatToAliasing) {
+  std::string string = "abc";
+  EXPECT_DEATH(FormatTo(&string, "{}", {string}), "");
+  static constexpr FormatString kFormat("{}");
+  EXPECT_DEATH(FormatTo<kFormat>(&string, string), "");
+}
+
+TEST(Format, FormatString) {
+  static constexpr FormatString kFormat("{} purchased {} {}");
+  static_assert(kFormat.arg_count() == 3);
+  static_assert(kFormat.text() == " purchased  ");
+  EXPECT_EQ(Format<kFormat>("Bob", 5, "Apples"), "Bob purchased 5 Apples");
+  EXPECT_EQ(Format<kFormat>("", "", ""), " purchased  ");
+
+  static constexpr FormatString kNoArgs("test");
+  EXPECT_EQ(Format<kNoArgs>(), "test");
+
+  static constexpr FormatString kEmpty("");
+  EXPECT_EQ(Format<kEmpty>(), "");
+
+  static constexpr FormatString kArgs("{}{}{}");
+  EXPECT_EQ(Format<kArgs>(std::string("a"), 1.5, true), "a1.5true");
+  EXPECT_EQ(Format<kArgs>(std::string_view(), 'c', NotNull("d")), "cd");
+}
+
+TEST(Format, FormatStringEscape) {
+  static constexpr FormatString kEscape("{{{}}} }}{{");
+  static_assert(kEscape.text() == "{} }{");
+  static_assert(kEscape.arg_count() == 1);
+  EXPECT_EQ(Format<kEscape>(42), "{42} }{");
+
+  static constexpr FormatString kMatches(
+      "before {{ {} after }} {} {}{{}}{}");
+  EXPECT_EQ(Format<kMatches>(1, 2, 3, 4),
+            Format("before {{ {} after }} {} {}{{}}{}", {1, 2, 3, 4}));
+}
+
+TEST(Format, FormatStringUnmatchedBraces) {
+  EXPECT_DEATH(FormatString("{"), "");
+  EXPECT_DEATH(FormatString("}"), "");
+  EXPECT_DEATH(FormatString("{0{}"), "");
+  EXPECT_DEATH(FormatString("a}b"), "");
+}
+
 }  // namespace rst
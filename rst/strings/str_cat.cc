@@ -35,15 +35,24 @@
 
 namespace rst {
 
-std::string StrCat(std::initializer_list<internal::Arg> values) {
+std::string StrCat(const std::initializer_list<internal::Arg> values) {
+  std::string output;
+  StrAppend(&output, values);
+  return output;
+}
+
+void StrAppend(const NotNull<std::string*> output,
+               const std::initializer_list<internal::Arg> values) {
   size_t new_size = 0;
-  for (const auto& val : values)
+  for (const auto& val : values) {
+    RST_DCHECK(!val.IsWithin(*output) && "Values must not refer to output");
     new_size += val.size();
+  }
 
-  std::string output;
-  StringResizeUninitialized(&output, new_size);
+  const auto old_size = output->size();
+  StringResizeUninitialized(output, old_size + new_size);
 
-  auto out = output.data();
+  auto out = output->data() + old_size;
   for (const auto& val : values) {
     if (const auto src = val.view(); !src.empty()) {
       std::memcpy(out, src.data(), src.size());
@@ -51,8 +60,7 @@ std::string StrCat(std::initializer_list<internal::Arg> values) {
     }
   }
 
-  RST_DCHECK(out == output.data() + output.size());
-  return output;
+  RST_DCHECK(out == output->data() + output->size());
 }
 
 }  // namespace rst
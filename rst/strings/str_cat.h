@@ -31,6 +31,7 @@
 #include <initializer_list>
 #include <string>
 
+#include "rst/not_null/not_null.h"
 #include "rst/strings/arg.h"
 
 namespace rst {
@@ -59,13 +60,29 @@ namespace rst {
 //   * `std::string_view`, `std::string`, `const char*`
 //   * `short`, `unsigned short`, `int`, `unsigned int`, `long`,
 //     `unsigned long`, `long long`, `unsigned long long`
-//   * `float`, `double`, `long double` (printed as if %g is specified for
-//     `printf()`)
+//   * `float`, `double`, `long double` (printed in the shortest form that
+//     parses back to the same value like `std::to_chars()`)
 //   * `bool` (printed as "true" or "false")
 //   * `char`
 //   * `enum`s (printed as underlying integer type)
 std::string StrCat(std::initializer_list<internal::Arg> values);
 
+// Appends the concatenation of |values| to |output|. The size of the result is
+// computed first, so |output| grows at most once and doesn't allocate if its
+// capacity suffices. This makes building strings in a loop with a reused
+// buffer allocation-free. |values| must not refer to |output|.
+//
+// Example:
+//
+//   #include "rst/strings/str_cat.h"
+//
+//   std::string s = "Bob";
+//   rst::StrAppend(&s, {" purchased ", 5, " ", "Apples"});
+//   RST_DCHECK(s == "Bob purchased 5 Apples");
+//
+void StrAppend(NotNull<std::string*> output,
+               std::initializer_list<internal::Arg> values);
+
 }  // namespace rst
 
 #endif  // RST_STRINGS_STR_CAT_H_
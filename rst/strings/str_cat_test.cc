@@ -27,17 +27,33 @@
 
 #include "rst/strings/str_cat.h"
 
+#include <charconv>
 #include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 #include <gtest/gtest.h>
 
+#include "rst/check/check.h"
 #include "rst/not_null/not_null.h"
 
 namespace rst {
+namespace {
+
+// Returns the shortest representation of |value| on this platform.
+template <class Float>
+std::string ToChars(const Float value) {
+  char buffer[64];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  RST_CHECK(result.ec == std::errc());
+  return std::string(buffer, result.ptr);
+}
+
+}  // namespace
 
 TEST(StrCat, NoArgs) { EXPECT_EQ(StrCat({"test"}), "test"); }
 
@@ -183,20 +199,17 @@ TEST(StrCat, MinMax) {
       std::numeric_limits<unsigned long long>::max());  // NOLINT(runtime/int)
   result += ' ';
 
-  std::ostringstream stream;
-  stream << std::numeric_limits<float>::min();
-  stream << ' ';
-  stream << std::numeric_limits<float>::max();
-  stream << ' ';
-  stream << std::numeric_limits<double>::min();
-  stream << ' ';
-  stream << std::numeric_limits<double>::max();
-  stream << ' ';
-  stream << std::numeric_limits<long double>::min();
-  stream << ' ';
-  stream << std::numeric_limits<long double>::max();
-
-  result += stream.str();
+  result += ToChars(std::numeric_limits<float>::min());
+  result += ' ';
+  result += ToChars(std::numeric_limits<float>::max());
+  result += ' ';
+  result += ToChars(std::numeric_limits<double>::min());
+  result += ' ';
+  result += ToChars(std::numeric_limits<double>::max());
+  result += ' ';
+  result += ToChars(std::numeric_limits<long double>::min());
+  result += ' ';
+  result += ToChars(std::numeric_limits<long double>::max());
 
   EXPECT_EQ(string, result);
 }
@@ -281,6 +294,56 @@ TEST(StrCat, Doubles) {
   }
 }
 
+TEST(StrCat, StrAppend) {
+  std::string string;
+  StrAppend(&string, {});
+  EXPECT_EQ(string, "");
+  StrAppend(&string, {"Bob"});
+  EXPECT_EQ(string, "Bob");
+  StrAppend(&string, {" purchased ", 5, " ", "Apples", ' ', 1.5, true});
+  EXPECT_EQ(string, "Bob purchased 5 Apples 1.5true");
+}
+
+TEST(StrCat, StrAppendReusesCapacity) {
+  std::string string;
+  string.reserve(100);
+  const auto data = string.data();
+  for (auto i = 0; i < 10; i++) {
+    string.clear();
+    StrAppend(&string, {"record ", i, ": ", std::string(50, 'a')});
+    EXPECT_EQ(string.data(), data);
+  }
+
+  EXPECT_EQ(string, StrCat({"record 9: ", std::string(50, 'a')}));
+}
+
+TEST(StrCat, StrAppendAliasing) {
+  std::string string = "abc";
+  EXPECT_DEATH(StrAppend(&string, {string}), "");
+  EXPECT_DEATH(StrAppend(&string, {std::string_view(string).substr(1)}), "");
+  StrAppend(&string, {std::string_view(string).substr(3)});
+  EXPECT_EQ(string, "abc");
+}
+
+TEST(StrCat, ShortestDoubles) {
+  EXPECT_EQ(StrCat({0.1}), "0.1");
+  EXPECT_EQ(StrCat({0.1f}), "0.1");
+  EXPECT_EQ(StrCat({1.0 / 3}), "0.3333333333333333");
+  EXPECT_EQ(StrCat({123456789.0}), "123456789");
+  EXPECT_EQ(StrCat({1e21}), "1e+21");
+  EXPECT_EQ(StrCat({1e-7}), "1e-07");
+  EXPECT_EQ(StrCat({-0.0}), "-0");
+  EXPECT_EQ(StrCat({-std::numeric_limits<double>::infinity()}), "-inf");
+
+  auto value = 1.0;
+  for (auto i = 0; i < 1000; i++) {
+    value = value * 1.37 + 0.001;
+    if (value > 1e300)
+      value = 1e-300;
+    EXPECT_EQ(std::strtod(StrCat({value}).c_str(), nullptr), value);
+  }
+}
+
 TEST(StrCat, Enum) {
   enum Old {
     kZero,
@@ -0,0 +1,490 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_TASK_RUNNER_PIPELINE_H_
+#define RST_TASK_RUNNER_PIPELINE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rst/check/check.h"
+#include "rst/macros/macros.h"
+#include "rst/macros/thread_annotations.h"
+#include "rst/not_null/not_null.h"
+#include "rst/stl/algorithm.h"
+#include "rst/task_runner/task_runner.h"
+#include "rst/type/type.h"
+
+namespace rst {
+
+// Maximum number of items a pipeline stage processes concurrently.
+using PipelineParallelism = Type<class PipelineParallelismTag, size_t>;
+// Whether a pipeline stage takes and emits items in the order they were pushed
+// into the pipeline.
+using PipelineOrdered = Type<class PipelineOrderedTag, bool>;
+
+namespace internal {
+
+// Limits the number of items that are inside of a pipeline at the same time.
+// Every pushed item holds one slot until it leaves the last stage, so the
+// buffers between stages can't grow beyond |max_in_flight| items in total.
+class PipelineState {
+ public:
+  explicit PipelineState(const size_t max_in_flight)
+      : max_in_flight_(max_in_flight) {
+    RST_DCHECK(max_in_flight > 0);
+  }
+  ~PipelineState() = default;
+
+  // Blocks until there is a free slot and returns the sequence number of the
+  // new item.
+  uint64_t Acquire() {
+    std::unique_lock lock(mutex_);
+    while (in_flight_ == max_in_flight_)
+      cv_.wait(lock);
+
+    in_flight_++;
+    return seq_++;
+  }
+
+  // Like Acquire() but returns false instead of blocking.
+  bool TryAcquire(const NotNull<uint64_t*> seq) {
+    std::lock_guard lock(mutex_);
+    if (in_flight_ == max_in_flight_)
+      return false;
+
+    in_flight_++;
+    *seq = seq_++;
+    return true;
+  }
+
+  // Frees the slot of an item that has left the pipeline.
+  void Release() {
+    {
+      std::lock_guard lock(mutex_);
+      RST_DCHECK(in_flight_ > 0);
+      in_flight_--;
+    }
+
+    cv_.notify_all();
+  }
+
+  // Blocks until all the items have left the pipeline.
+  void WaitIdle() {
+    std::unique_lock lock(mutex_);
+    while (in_flight_ != 0)
+      cv_.wait(lock);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  const size_t max_in_flight_;
+  size_t in_flight_ RST_GUARDED_BY(mutex_) = 0;
+  // Increasing item counter.
+  uint64_t seq_ RST_GUARDED_BY(mutex_) = 0;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(PipelineState);
+};
+
+// Input of a pipeline stage.
+template <class In>
+class PipelineNode {
+ public:
+  virtual ~PipelineNode() = default;
+
+  // Enqueues |item| with the sequence number |seq|. Never blocks.
+  virtual void Push(uint64_t seq, In&& item) = 0;
+};
+
+// Buffers incoming items and runs up to |parallelism| tasks on |task_runner|
+// that process them.
+template <class In>
+class PipelineStageBase
+    : public PipelineNode<In>,
+      public std::enable_shared_from_this<PipelineStageBase<In>> {
+ public:
+  PipelineStageBase(const NotNull<TaskRunner*> task_runner,
+                    const PipelineParallelism parallelism,
+                    const PipelineOrdered ordered)
+      : task_runner_(*task_runner),
+        parallelism_(parallelism.value()),
+        ordered_(ordered.value()) {
+    RST_DCHECK(parallelism_ > 0);
+  }
+  ~PipelineStageBase() override = default;
+
+  // PipelineNode:
+  void Push(const uint64_t seq, In&& item) final {
+    {
+      std::lock_guard lock(mutex_);
+      queue_.emplace_back(seq, std::move(item));
+      c_push_heap(queue_, std::greater<>());
+
+      if (running_ == parallelism_ || !CanStart(queue_, ordered_, next_seq_))
+        return;
+
+      running_++;
+    }
+
+    task_runner_.PostTask(
+        [self = this->shared_from_this()]() { self->RunTasks(); });
+  }
+
+ protected:
+  // Processes a single item. Can be called concurrently up to |parallelism_|
+  // times.
+  virtual void Process(uint64_t seq, In&& item) = 0;
+
+  bool ordered() const { return ordered_; }
+
+ private:
+  struct Entry {
+    Entry(const uint64_t seq, In&& item) : seq(seq), item(std::move(item)) {}
+    Entry(Entry&&) noexcept = default;
+    ~Entry() = default;
+
+    Entry& operator=(Entry&&) noexcept = default;
+    bool operator>(const Entry& entry) const { return seq > entry.seq; }
+
+    uint64_t seq = 0;
+    In item;
+
+   private:
+    RST_DISALLOW_COPY_AND_ASSIGN(Entry);
+  };
+
+  void RunTasks() {
+    while (true) {
+      std::unique_lock lock(mutex_);
+      if (!CanStart(queue_, ordered_, next_seq_)) {
+        running_--;
+        return;
+      }
+
+      c_pop_heap(queue_, std::greater<>());
+      auto entry = std::move(queue_.back());
+      queue_.pop_back();
+      next_seq_++;
+      lock.unlock();
+
+      Process(entry.seq, std::move(entry.item));
+    }
+  }
+
+  // An ordered stage waits for the item with the next sequence number, an
+  // unordered one takes the oldest item available.
+  static bool CanStart(const std::vector<Entry>& queue, const bool ordered,
+                       const uint64_t next_seq) {
+    if (queue.empty())
+      return false;
+    return !ordered || queue.front().seq == next_seq;
+  }
+
+  TaskRunner& task_runner_;
+  const size_t parallelism_;
+  const bool ordered_;
+
+  std::mutex mutex_;
+  // Priority queue of items ordered by their sequence numbers.
+  std::vector<Entry> queue_ RST_GUARDED_BY(mutex_);
+  // Number of tasks processing items of this stage.
+  size_t running_ RST_GUARDED_BY(mutex_) = 0;
+  // Sequence number of the next item to start for an ordered stage.
+  uint64_t next_seq_ RST_GUARDED_BY(mutex_) = 0;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(PipelineStageBase);
+};
+
+// Transforms |In| items into |Out| ones and passes them to the |next| stage.
+template <class In, class Out>
+class PipelineStage final : public PipelineStageBase<In> {
+ public:
+  PipelineStage(const NotNull<TaskRunner*> task_runner,
+                const PipelineParallelism parallelism,
+                const PipelineOrdered ordered,
+                std::function<Out(In&&)>&& function,
+                NotNull<std::shared_ptr<PipelineNode<Out>>> next)
+      : PipelineStageBase<In>(task_runner, parallelism, ordered),
+        function_(std::move(function)),
+        next_(std::move(next)) {
+    RST_DCHECK(function_ != nullptr);
+  }
+  ~PipelineStage() override = default;
+
+ private:
+  // PipelineStageBase:
+  void Process(const uint64_t seq, In&& item) override {
+    auto result = function_(std::move(item));
+    if (!this->ordered()) {
+      next_->Push(seq, std::move(result));
+      return;
+    }
+
+    // Results of concurrently processed items are reordered before they are
+    // emitted. Only one thread emits at a time to keep the order downstream.
+    std::unique_lock lock(results_mutex_);
+    results_.emplace(seq, std::move(result));
+    if (is_emitting_)
+      return;
+
+    is_emitting_ = true;
+    for (auto it = results_.begin();
+         it != results_.end() && it->first == next_emit_seq_;
+         it = results_.begin()) {
+      auto node = results_.extract(it);
+      next_emit_seq_++;
+
+      lock.unlock();
+      next_->Push(node.key(), std::move(node.mapped()));
+      lock.lock();
+    }
+    is_emitting_ = false;
+  }
+
+  const std::function<Out(In&&)> function_;
+  const NotNull<std::shared_ptr<PipelineNode<Out>>> next_;
+
+  std::mutex results_mutex_;
+  // Processed items waiting for their predecessors.
+  std::map<uint64_t, Out> results_ RST_GUARDED_BY(results_mutex_);
+  // Sequence number of the next item to emit.
+  uint64_t next_emit_seq_ RST_GUARDED_BY(results_mutex_) = 0;
+  bool is_emitting_ RST_GUARDED_BY(results_mutex_) = false;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(PipelineStage);
+};
+
+// The last stage of a pipeline that consumes items.
+template <class In>
+class PipelineSink final : public PipelineStageBase<In> {
+ public:
+  PipelineSink(const NotNull<TaskRunner*> task_runner,
+               const PipelineParallelism parallelism,
+               const PipelineOrdered ordered,
+               std::function<void(In&&)>&& function,
+               NotNull<std::shared_ptr<PipelineState>> state)
+      : PipelineStageBase<In>(task_runner, parallelism, ordered),
+        function_(std::move(function)),
+        state_(std::move(state)) {
+    RST_DCHECK(function_ != nullptr);
+  }
+  ~PipelineSink() override = default;
+
+ private:
+  // PipelineStageBase:
+  void Process(uint64_t, In&& item) override {
+    function_(std::move(item));
+    state_->Release();
+  }
+
+  const std::function<void(In&&)> function_;
+  const NotNull<std::shared_ptr<PipelineState>> state_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(PipelineSink);
+};
+
+}  // namespace internal
+
+template <class In, class Out>
+class PipelineBuilder;
+
+// A multi-stage pipeline that streams items through typed stages running on
+// task runners. Items are moved between stages and never copied.
+//
+// Every stage processes up to `rst::PipelineParallelism` items concurrently.
+// An `rst::PipelineOrdered` stage starts and emits items in the order they
+// were pushed into the pipeline, an unordered one handles them as soon as
+// they arrive.
+//
+// At most |max_in_flight| items can be inside of a pipeline, which bounds the
+// buffers between stages. `Push()` blocks until an item leaves the last stage
+// if the limit is reached, so the memory used by a pipeline stays constant no
+// matter how long the input is. Stage tasks never block, so any
+// `rst::TaskRunner` can run them.
+//
+// Example:
+//
+//   #include "rst/task_runner/pipeline.h"
+//
+//   rst::ThreadPoolTaskRunner task_runner(...);
+//   rst::NotNull<std::unique_ptr<rst::Pipeline<std::string>>> pipeline =
+//       rst::PipelineBuilder<std::string>(&task_runner, /*max_in_flight=*/64)
+//           .AddStage<Record>(
+//               [](std::string&& line) -> Record { return Parse(line); },
+//               rst::PipelineParallelism(4))
+//           .AddStage<std::string>(
+//               [](Record&& record) -> std::string {
+//                 return Transform(record);
+//               },
+//               rst::PipelineParallelism(4), rst::PipelineOrdered(true))
+//           .Build([&file](std::string&& row) { file.Write(row); },
+//                  rst::PipelineParallelism(1), rst::PipelineOrdered(true));
+//
+//   for (std::string line; ReadLine(&line);)
+//     pipeline->Push(std::move(line));
+//   pipeline->Wait();
+//
+template <class In>
+class Pipeline {
+ public:
+  // Waits for all the pushed items to leave the pipeline.
+  ~Pipeline() { Wait(); }
+
+  // Pushes |item| into the first stage. Blocks while |max_in_flight| items are
+  // inside of the pipeline. Don't call it from a thread that runs the stages
+  // of the pipeline, e.g. with `rst::PollingTaskRunner`, use `TryPush()`
+  // instead.
+  void Push(In&& item) {
+    const auto seq = state_->Acquire();
+    head_->Push(seq, std::move(item));
+  }
+
+  // Like `Push()` but returns false and leaves |item| untouched instead of
+  // blocking.
+  [[nodiscard]] bool TryPush(In&& item) {
+    uint64_t seq = 0;
+    if (!state_->TryAcquire(&seq))
+      return false;
+
+    head_->Push(seq, std::move(item));
+    return true;
+  }
+
+  // Blocks until all the pushed items leave the pipeline.
+  void Wait() { state_->WaitIdle(); }
+
+ private:
+  template <class, class>
+  friend class PipelineBuilder;
+
+  Pipeline(NotNull<std::shared_ptr<internal::PipelineState>> state,
+           NotNull<std::shared_ptr<internal::PipelineNode<In>>> head)
+      : state_(std::move(state)), head_(std::move(head)) {}
+
+  const NotNull<std::shared_ptr<internal::PipelineState>> state_;
+  const NotNull<std::shared_ptr<internal::PipelineNode<In>>> head_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(Pipeline);
+};
+
+// Builds `rst::Pipeline` that takes |In| items. |Out| is the type of items
+// produced by the last added stage.
+template <class In, class Out = In>
+class PipelineBuilder {
+ public:
+  // Stages run on |task_runner|. At most |max_in_flight| items can be inside
+  // of the pipeline at the same time.
+  PipelineBuilder(const NotNull<TaskRunner*> task_runner,
+                  const size_t max_in_flight)
+      : task_runner_(task_runner),
+        max_in_flight_(max_in_flight),
+        make_head_(
+            [](std::shared_ptr<internal::PipelineNode<Out>> next)
+                -> std::shared_ptr<internal::PipelineNode<In>> {
+              return next;
+            }) {
+    static_assert(std::is_same_v<In, Out>);
+    RST_DCHECK(max_in_flight > 0);
+  }
+  PipelineBuilder(PipelineBuilder&&) noexcept = default;
+  ~PipelineBuilder() = default;
+
+  PipelineBuilder& operator=(PipelineBuilder&&) noexcept = default;
+
+  // Appends a stage that converts |Out| items into |Next| ones with
+  // |function|.
+  template <class Next>
+  PipelineBuilder<In, Next> AddStage(
+      std::function<Next(Out&&)>&& function,
+      const PipelineParallelism parallelism = PipelineParallelism(1),
+      const PipelineOrdered ordered = PipelineOrdered(false)) && {
+    RST_DCHECK(function != nullptr);
+
+    auto make_next_head =
+        [make_head = std::move(make_head_), task_runner = task_runner_,
+         function = std::move(function), parallelism, ordered](
+            std::shared_ptr<internal::PipelineNode<Next>> next) mutable {
+          return make_head(std::make_shared<internal::PipelineStage<Out, Next>>(
+              task_runner, parallelism, ordered, std::move(function),
+              std::move(next)));
+        };
+
+    return PipelineBuilder<In, Next>(task_runner_, max_in_flight_,
+                                     std::move(make_next_head));
+  }
+
+  // Finishes the pipeline with a stage that consumes |Out| items with
+  // |function|.
+  NotNull<std::unique_ptr<Pipeline<In>>> Build(
+      std::function<void(Out&&)>&& function,
+      const PipelineParallelism parallelism = PipelineParallelism(1),
+      const PipelineOrdered ordered = PipelineOrdered(false)) && {
+    RST_DCHECK(function != nullptr);
+
+    auto state = std::make_shared<internal::PipelineState>(max_in_flight_);
+    auto sink = std::make_shared<internal::PipelineSink<Out>>(
+        task_runner_, parallelism, ordered, std::move(function), state);
+    auto head = make_head_(std::move(sink));
+    return std::unique_ptr<Pipeline<In>>(
+        new Pipeline<In>(std::move(state), std::move(head)));
+  }
+
+ private:
+  template <class, class>
+  friend class PipelineBuilder;
+
+  using MakeHeadFunction =
+      std::function<std::shared_ptr<internal::PipelineNode<In>>(
+          std::shared_ptr<internal::PipelineNode<Out>>)>;
+
+  PipelineBuilder(const NotNull<TaskRunner*> task_runner,
+                  const size_t max_in_flight, MakeHeadFunction&& make_head)
+      : task_runner_(task_runner),
+        max_in_flight_(max_in_flight),
+        make_head_(std::move(make_head)) {}
+
+  NotNull<TaskRunner*> task_runner_;
+  size_t max_in_flight_ = 0;
+  // Creates the stages added so far given the next stage after them and
+  // returns the first one.
+  MakeHeadFunction make_head_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(PipelineBuilder);
+};
+
+}  // namespace rst
+
+#endif  // RST_TASK_RUNNER_PIPELINE_H_
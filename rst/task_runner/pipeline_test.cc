@@ -0,0 +1,205 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/task_runner/pipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rst/stl/algorithm.h"
+#include "rst/task_runner/polling_task_runner.h"
+#include "rst/task_runner/thread_pool_task_runner.h"
+
+namespace chrono = std::chrono;
+
+namespace rst {
+
+TEST(Pipeline, PollingTaskRunner) {
+  PollingTaskRunner task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); });
+
+  std::vector<std::string> result;
+  auto pipeline =
+      PipelineBuilder<int>(&task_runner, 10)
+          .AddStage<int>([](int&& i) -> int { return i * 2; })
+          .AddStage<std::string>(
+              [](int&& i) -> std::string { return std::to_string(i); })
+          .Build([&result](std::string&& s) {
+            result.emplace_back(std::move(s));
+          });
+
+  for (auto i = 0; i < 10; i++)
+    EXPECT_TRUE(pipeline->TryPush(int{i}));
+
+  while (result.size() != 10)
+    task_runner.RunPendingTasks();
+
+  pipeline->Wait();
+  EXPECT_EQ(result, std::vector<std::string>({"0", "2", "4", "6", "8", "10",
+                                              "12", "14", "16", "18"}));
+}
+
+TEST(Pipeline, TryPushIsBounded) {
+  PollingTaskRunner task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); });
+
+  std::vector<int> result;
+  auto pipeline = PipelineBuilder<int>(&task_runner, 3).Build(
+      [&result](int&& i) { result.emplace_back(i); });
+
+  EXPECT_TRUE(pipeline->TryPush(1));
+  EXPECT_TRUE(pipeline->TryPush(2));
+  EXPECT_TRUE(pipeline->TryPush(3));
+  EXPECT_FALSE(pipeline->TryPush(4));
+
+  task_runner.RunPendingTasks();
+  EXPECT_EQ(result, std::vector<int>({1, 2, 3}));
+
+  EXPECT_TRUE(pipeline->TryPush(4));
+  task_runner.RunPendingTasks();
+  EXPECT_EQ(result, std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST(Pipeline, MovesItems) {
+  PollingTaskRunner task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); });
+
+  std::vector<int> result;
+  auto pipeline =
+      PipelineBuilder<std::unique_ptr<int>>(&task_runner, 2)
+          .AddStage<std::unique_ptr<int>>(
+              [](std::unique_ptr<int>&& i) -> std::unique_ptr<int> {
+                (*i)++;
+                return std::move(i);
+              })
+          .Build([&result](std::unique_ptr<int>&& i) {
+            result.emplace_back(*i);
+          });
+
+  EXPECT_TRUE(pipeline->TryPush(std::make_unique<int>(1)));
+  EXPECT_TRUE(pipeline->TryPush(std::make_unique<int>(2)));
+  while (result.size() != 2)
+    task_runner.RunPendingTasks();
+
+  EXPECT_EQ(result, std::vector<int>({2, 3}));
+}
+
+TEST(Pipeline, OrderedParallelStages) {
+  ThreadPoolTaskRunner task_runner(
+      8, []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      chrono::seconds(60));
+
+  static constexpr auto kItems = 1000;
+  std::vector<int> result, expected;
+  auto pipeline =
+      PipelineBuilder<int>(&task_runner, 16)
+          .AddStage<int>([](int&& i) -> int { return i + 1; },
+                         PipelineParallelism(4))
+          .AddStage<int>([](int&& i) -> int { return i * 3; },
+                         PipelineParallelism(4), PipelineOrdered(true))
+          .Build([&result](int&& i) { result.emplace_back(i); },
+                 PipelineParallelism(1), PipelineOrdered(true));
+
+  for (auto i = 0; i < kItems; i++) {
+    pipeline->Push(int{i});
+    expected.emplace_back((i + 1) * 3);
+  }
+
+  pipeline->Wait();
+  EXPECT_EQ(result, expected);
+}
+
+TEST(Pipeline, UnorderedParallelStages) {
+  ThreadPoolTaskRunner task_runner(
+      8, []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      chrono::seconds(60));
+
+  static constexpr auto kItems = 1000;
+  std::mutex mtx;
+  std::vector<int> result, expected;
+  auto pipeline =
+      PipelineBuilder<int>(&task_runner, 16)
+          .AddStage<int>([](int&& i) -> int { return i - 1; },
+                         PipelineParallelism(4))
+          .Build(
+              [&mtx, &result](int&& i) {
+                std::lock_guard lock(mtx);
+                result.emplace_back(i);
+              },
+              PipelineParallelism(4));
+
+  for (auto i = 0; i < kItems; i++) {
+    pipeline->Push(int{i});
+    expected.emplace_back(i - 1);
+  }
+
+  pipeline->Wait();
+  c_sort(result);
+  EXPECT_EQ(result, expected);
+}
+
+TEST(Pipeline, Backpressure) {
+  ThreadPoolTaskRunner task_runner(
+      8, []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      chrono::seconds(60));
+
+  static constexpr size_t kMaxInFlight = 4;
+  std::atomic<size_t> in_flight = 0;
+  std::atomic<size_t> max_in_flight = 0;
+  auto pipeline =
+      PipelineBuilder<int>(&task_runner, kMaxInFlight)
+          .AddStage<int>(
+              [&in_flight, &max_in_flight](int&& i) -> int {
+                const auto current = ++in_flight;
+                auto max = max_in_flight.load();
+                while (max < current &&
+                       !max_in_flight.compare_exchange_weak(max, current)) {
+                }
+                return i;
+              },
+              PipelineParallelism(8))
+          .Build([&in_flight](int&&) { in_flight--; }, PipelineParallelism(8));
+
+  for (auto i = 0; i < 1000; i++)
+    pipeline->Push(int{i});
+
+  pipeline->Wait();
+  EXPECT_EQ(in_flight, 0U);
+  EXPECT_LE(max_in_flight, kMaxInFlight);
+  EXPECT_GT(max_in_flight, 0U);
+}
+
+}  // namespace rst
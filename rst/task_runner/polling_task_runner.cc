@@ -35,10 +35,19 @@
 namespace chrono = std::chrono;
 
 namespace rst {
+namespace {
+
+// Used to not to allocate memory on every RunPendingTasks() call in the multi
+// consumer mode.
+thread_local std::vector<internal::IterationItem> t_pending_tasks;
+
+}  // namespace
 
 PollingTaskRunner::PollingTaskRunner(
-    std::function<chrono::nanoseconds()>&& time_function)
-    : time_function_(std::move(time_function)) {}
+    std::function<chrono::nanoseconds()>&& time_function,
+    const MultiConsumer multi_consumer)
+    : time_function_(std::move(time_function)),
+      multi_consumer_(multi_consumer.value()) {}
 
 PollingTaskRunner::~PollingTaskRunner() = default;
 
@@ -56,6 +65,11 @@ void PollingTaskRunner::PostDelayedTaskWithIterations(
 }
 
 void PollingTaskRunner::RunPendingTasks() {
+  if (multi_consumer_) {
+    RunPendingTasksMultiConsumer();
+    return;
+  }
+
   {
     std::lock_guard lock(mutex_);
 
@@ -80,4 +94,76 @@ void PollingTaskRunner::RunPendingTasks() {
   pending_tasks_.clear();
 }
 
+void PollingTaskRunner::RunPendingTasksMultiConsumer() {
+  // Takes the buffer of the current thread. A task can run pending tasks of
+  // another task runner, in this case the nested call gets an empty buffer.
+  auto pending_tasks = std::move(t_pending_tasks);
+  pending_tasks.clear();
+
+  {
+    std::lock_guard lock(mutex_);
+
+    const auto now = time_function_();
+    while (!queue_.empty()) {
+      auto& item = queue_.front();
+      if (now < item.time_point)
+        break;
+
+      if (item.iterations == 0) {
+        pending_tasks.emplace_back(std::move(item.task), 0);
+      } else {
+        // Other consumers join the task through |iterated_tasks_|, this one
+        // runs it in the queue order.
+        auto iterated_task = std::make_shared<IteratedTask>(
+            std::move(item.task), item.iterations + 1);
+        iterated_tasks_.emplace_back(iterated_task);
+        pending_tasks.emplace_back(
+            [iterated_task = std::move(iterated_task)]() {
+              iterated_task->Run();
+            },
+            0);
+      }
+
+      c_pop_heap(queue_, std::greater<>());
+      queue_.pop_back();
+    }
+  }
+
+  for (const auto& task : pending_tasks)
+    task.task();
+
+  RunIteratedTasks();
+
+  pending_tasks.clear();
+  t_pending_tasks = std::move(pending_tasks);
+}
+
+void PollingTaskRunner::RunIteratedTasks() {
+  while (true) {
+    std::shared_ptr<IteratedTask> iterated_task;
+
+    {
+      std::lock_guard lock(mutex_);
+
+      // Drops the tasks which iterations have all been taken by consumers.
+      while (!iterated_tasks_.empty()) {
+        const auto& front = iterated_tasks_.front();
+        if (front->next_iteration.load(std::memory_order_relaxed) <
+            front->iterations) {
+          break;
+        }
+
+        iterated_tasks_.pop_front();
+      }
+
+      if (iterated_tasks_.empty())
+        return;
+
+      iterated_task = iterated_tasks_.front();
+    }
+
+    iterated_task->Run();
+  }
+}
+
 }  // namespace rst
@@ -28,9 +28,13 @@
 #ifndef RST_TASK_RUNNER_POLLING_TASK_RUNNER_H_
 #define RST_TASK_RUNNER_POLLING_TASK_RUNNER_H_
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -39,6 +43,7 @@
 #include "rst/task_runner/item.h"
 #include "rst/task_runner/iteration_item.h"
 #include "rst/task_runner/task_runner.h"
+#include "rst/type/type.h"
 
 namespace rst {
 
@@ -59,28 +64,83 @@ namespace rst {
 //     // ...
 //   }
 //
+// In the multi consumer mode several threads can run tasks of the same task
+// runner:
+//
+//   rst::PollingTaskRunner task_runner(
+//       std::move(time_function),
+//       rst::PollingTaskRunner::MultiConsumer(true));
+//   // On every I/O thread.
+//   for (;; task_runner.RunPendingTasks()) {
+//     // ...
+//   }
+//
 class PollingTaskRunner : public TaskRunner {
  public:
-  // Takes |time_function| that returns current time.
+  using MultiConsumer = Type<class MultiConsumerTag, bool>;
+
+  // Takes |time_function| that returns current time. If |multi_consumer| is
+  // set, RunPendingTasks() can be called from several threads concurrently.
   explicit PollingTaskRunner(
-      std::function<std::chrono::nanoseconds()>&& time_function);
+      std::function<std::chrono::nanoseconds()>&& time_function,
+      MultiConsumer multi_consumer = MultiConsumer(false));
   ~PollingTaskRunner() override;
 
-  // Runs all pending tasks in interval (-inf, time_function_()].
+  // Runs all pending tasks in interval (-inf, time_function_()] in the order of
+  // their time points. In the multi consumer mode iterations of a task posted
+  // with iterations (see ApplyTaskSync()) are split between all the threads
+  // that are running pending tasks at the moment, and the tasks due after it
+  // start once all its iterations have been taken.
   void RunPendingTasks();
 
  private:
+  // A task which iterations are run by several consumers concurrently.
+  struct IteratedTask {
+    IteratedTask(std::function<void()>&& task, const size_t iterations)
+        : task(std::move(task)), iterations(iterations) {}
+    ~IteratedTask() = default;
+
+    const std::function<void()> task;
+    // Total number of iterations.
+    const size_t iterations;
+    // Index of the next iteration to run.
+    std::atomic<size_t> next_iteration = 0;
+
+    // Runs iterations until all of them have been taken by consumers.
+    void Run() {
+      while (next_iteration.fetch_add(1, std::memory_order_relaxed) <
+             iterations) {
+        task();
+      }
+    }
+
+   private:
+    RST_DISALLOW_COPY_AND_ASSIGN(IteratedTask);
+  };
+
   // TaskRunner:
   void PostDelayedTaskWithIterations(std::function<void()>&& task,
                                      std::chrono::nanoseconds delay,
                                      size_t iterations) override;
+
+  void RunPendingTasksMultiConsumer();
+  // Runs the remaining iterations of |iterated_tasks_| together with other
+  // consumers.
+  void RunIteratedTasks();
+
   std::mutex mutex_;
   // Returns current time.
   const std::function<std::chrono::nanoseconds()> time_function_;
-  // Used to not to allocate memory on every RunPendingTasks() call.
+  const bool multi_consumer_;
+  // Used to not to allocate memory on every RunPendingTasks() call in the
+  // single consumer mode. Consumers use their own thread local buffers in the
+  // multi consumer mode.
   std::vector<internal::IterationItem> pending_tasks_;
   // Priority queue of tasks.
   std::vector<internal::Item> queue_ RST_GUARDED_BY(mutex_);
+  // Due tasks with iterations in the multi consumer mode.
+  std::deque<std::shared_ptr<IteratedTask>> iterated_tasks_
+      RST_GUARDED_BY(mutex_);
   // Increasing task counter.
   uint64_t task_id_ RST_GUARDED_BY(mutex_) = 0;
 
@@ -27,7 +27,11 @@
 
 #include "rst/task_runner/polling_task_runner.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -152,6 +156,105 @@ TEST(PollingTaskRunner, ApplyTaskSync) {
   }
 }
 
+TEST(PollingTaskRunner, MultiConsumerPostTaskInOrder) {
+  PollingTaskRunner task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      PollingTaskRunner::MultiConsumer(true));
+
+  std::vector<int> result, expected;
+  for (auto i = 0; i < 1000; i++) {
+    task_runner.PostTask([i, &result]() { result.emplace_back(i); });
+    expected.emplace_back(i);
+  }
+
+  task_runner.RunPendingTasks();
+  EXPECT_EQ(result, expected);
+}
+
+TEST(PollingTaskRunner, IteratedTaskRunsInQueueOrder) {
+  for (const auto multi_consumer : {false, true}) {
+    const auto main_thread_id = std::this_thread::get_id();
+    std::atomic<bool> is_posting = false;
+    std::atomic<int64_t> now = 0;
+    PollingTaskRunner task_runner(
+        [main_thread_id, &is_posting, &now]() -> chrono::nanoseconds {
+          if (std::this_thread::get_id() != main_thread_id)
+            is_posting = true;
+          return chrono::nanoseconds(now);
+        },
+        PollingTaskRunner::MultiConsumer(multi_consumer));
+
+    std::vector<int> result;
+    std::thread poster([&task_runner, &result]() {
+      task_runner.ApplyTaskSync([&result](size_t) { result.emplace_back(0); },
+                                2);
+    });
+    while (!is_posting)
+      std::this_thread::yield();
+    // Lets the poster push the task after reading the time.
+    std::this_thread::sleep_for(chrono::milliseconds(100));
+
+    now = 1;
+    task_runner.PostTask([&result]() { result.emplace_back(1); });
+    task_runner.RunPendingTasks();
+    poster.join();
+    EXPECT_EQ(result, (std::vector<int>{0, 0, 1}));
+  }
+}
+
+TEST(PollingTaskRunner, MultiConsumerApplyTaskSync) {
+  PollingTaskRunner task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      PollingTaskRunner::MultiConsumer(true));
+
+  static constexpr size_t kIterations = 1000;
+  static constexpr size_t kConsumersNumber = 4;
+
+  std::atomic<bool> done = false;
+  std::vector<std::thread> consumers;
+  consumers.reserve(kConsumersNumber);
+  for (size_t i = 0; i < kConsumersNumber; i++) {
+    consumers.emplace_back([&task_runner, &done]() {
+      while (!done)
+        task_runner.RunPendingTasks();
+    });
+  }
+
+  for (auto i = 0; i < 10; i++) {
+    const auto calls = std::make_unique<std::atomic<int>[]>(kIterations);
+    task_runner.ApplyTaskSync(
+        [&calls](const size_t iteration) { calls[iteration]++; }, kIterations);
+
+    for (size_t j = 0; j < kIterations; j++)
+      EXPECT_EQ(calls[j], 1);
+  }
+
+  done = true;
+  for (auto& consumer : consumers)
+    consumer.join();
+}
+
+TEST(PollingTaskRunner, MultiConsumerNestedRunPendingTasks) {
+  PollingTaskRunner outer_task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      PollingTaskRunner::MultiConsumer(true));
+  PollingTaskRunner inner_task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
+      PollingTaskRunner::MultiConsumer(true));
+
+  std::vector<int> result;
+  inner_task_runner.PostTask([&result]() { result.emplace_back(1); });
+  inner_task_runner.PostTask([&result]() { result.emplace_back(2); });
+  outer_task_runner.PostTask([&result, &inner_task_runner]() {
+    result.emplace_back(0);
+    inner_task_runner.RunPendingTasks();
+  });
+  outer_task_runner.PostTask([&result]() { result.emplace_back(3); });
+
+  outer_task_runner.RunPendingTasks();
+  EXPECT_EQ(result, (std::vector<int>{0, 1, 2, 3}));
+}
+
 TEST(PollingTaskRunner, CrashOnZeroIteration) {
   PollingTaskRunner task_runner(
       []() -> chrono::nanoseconds { return chrono::nanoseconds(0); });
@@ -27,8 +27,16 @@
 
 #include "rst/task_runner/thread_pool_task_runner.h"
 
+#include <algorithm>
 #include <utility>
 
+#if RST_BUILDFLAG(OS_LINUX)
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif  // RST_BUILDFLAG(OS_LINUX)
+
 #include "rst/check/check.h"
 #include "rst/defer/defer.h"
 #include "rst/stl/algorithm.h"
@@ -36,6 +44,22 @@
 namespace chrono = std::chrono;
 
 namespace rst {
+namespace {
+
+// std::chrono::steady_clock is based on CLOCK_MONOTONIC on Linux.
+chrono::nanoseconds MonotonicTime() {
+  return chrono::steady_clock::now().time_since_epoch();
+}
+
+#if RST_BUILDFLAG(OS_LINUX)
+int CreateTimerFd() {
+  const auto fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  RST_CHECK(fd != -1);
+  return fd;
+}
+#endif  // RST_BUILDFLAG(OS_LINUX)
+
+}  // namespace
 
 ThreadPoolTaskRunner::DelayedTaskRunner::DelayedTaskRunner(
     const size_t max_threads_num, const chrono::nanoseconds keep_alive_time)
@@ -167,9 +191,13 @@ void ThreadPoolTaskRunner::DelayedTaskRunner::PushTask(
 
 ThreadPoolTaskRunner::ServiceTaskRunner::ServiceTaskRunner(
     const NotNull<DelayedTaskRunner*> delayed_task_runner,
-    std::function<std::chrono::nanoseconds()>&& time_function)
+    std::function<std::chrono::nanoseconds()>&& time_function,
+    [[maybe_unused]] const bool use_timer_fd)
     : time_function_(std::move(time_function)),
       delayed_task_runner_(*delayed_task_runner),
+#if RST_BUILDFLAG(OS_LINUX)
+      timer_fd_(use_timer_fd ? CreateTimerFd() : -1),
+#endif  // RST_BUILDFLAG(OS_LINUX)
 #pragma warning(push)
 #pragma warning(disable : 4355)
       thread_(&ServiceTaskRunner::WaitAndScheduleTasks, this)
@@ -181,13 +209,31 @@ ThreadPoolTaskRunner::ServiceTaskRunner::~ServiceTaskRunner() {
   {
     std::lock_guard lock(thread_mutex_);
     should_exit_ = true;
+
+#if RST_BUILDFLAG(OS_LINUX)
+    // Wakes up the service thread immediately.
+    if (timer_fd_ != -1)
+      ArmTimer(chrono::nanoseconds(1));
+#endif  // RST_BUILDFLAG(OS_LINUX)
   }
 
   thread_cv_.notify_one();
   thread_.join();
+
+#if RST_BUILDFLAG(OS_LINUX)
+  if (timer_fd_ != -1)
+    RST_CHECK(close(timer_fd_) == 0);
+#endif  // RST_BUILDFLAG(OS_LINUX)
 }
 
 void ThreadPoolTaskRunner::ServiceTaskRunner::WaitAndScheduleTasks() {
+#if RST_BUILDFLAG(OS_LINUX)
+  if (timer_fd_ != -1) {
+    WaitAndScheduleTasksWithTimerFd();
+    return;
+  }
+#endif  // RST_BUILDFLAG(OS_LINUX)
+
   std::vector<internal::IterationItem> tasks;
 
   while (true) {
@@ -211,20 +257,61 @@ void ThreadPoolTaskRunner::ServiceTaskRunner::WaitAndScheduleTasks() {
       if (should_exit_)
         return;
 
-      if (delayed_tasks_.empty())
-        continue;
+      TakeDueTasks(&tasks);
+    }
 
-      const auto now = time_function_();
-      RST_DCHECK(tasks.empty());
-      while (!delayed_tasks_.empty()) {
-        auto& item = delayed_tasks_.front();
-        if (now < item.time_point)
-          break;
+    if (!tasks.empty()) {
+      delayed_task_runner_.PushTasks(&tasks);
+      tasks.clear();
+    }
+  }
+}
 
-        tasks.emplace_back(std::move(item.task), item.iterations);
-        c_pop_heap(delayed_tasks_, std::greater<>());
-        delayed_tasks_.pop_back();
-      }
+void ThreadPoolTaskRunner::ServiceTaskRunner::TakeDueTasks(
+    const NotNull<std::vector<internal::IterationItem>*> tasks) {
+  if (delayed_tasks_.empty())
+    return;
+
+  const auto now = time_function_();
+  RST_DCHECK(tasks->empty());
+  while (!delayed_tasks_.empty()) {
+    auto& item = delayed_tasks_.front();
+    if (now < item.time_point)
+      break;
+
+    tasks->emplace_back(std::move(item.task), item.iterations);
+    c_pop_heap(delayed_tasks_, std::greater<>());
+    delayed_tasks_.pop_back();
+  }
+}
+
+#if RST_BUILDFLAG(OS_LINUX)
+void ThreadPoolTaskRunner::ServiceTaskRunner::
+    WaitAndScheduleTasksWithTimerFd() {
+  RST_DCHECK(timer_fd_ != -1);
+
+  std::vector<internal::IterationItem> tasks;
+
+  while (true) {
+    // Blocks until the armed deadline comes. The deadline can be moved by
+    // other threads while waiting.
+    uint64_t expirations = 0;
+    const auto expired = read(timer_fd_, &expirations, sizeof(expirations)) ==
+                         sizeof(expirations);
+    RST_CHECK(expired || errno == EINTR);
+
+    {
+      std::lock_guard lock(thread_mutex_);
+
+      if (should_exit_)
+        return;
+
+      TakeDueTasks(&tasks);
+
+      // The timer is one-shot, so after expiration it's re-armed for the new
+      // earliest task.
+      if (expired && !delayed_tasks_.empty())
+        ArmTimer(delayed_tasks_.front().time_point);
     }
 
     if (!tasks.empty()) {
@@ -234,6 +321,22 @@ void ThreadPoolTaskRunner::ServiceTaskRunner::WaitAndScheduleTasks() {
   }
 }
 
+void ThreadPoolTaskRunner::ServiceTaskRunner::ArmTimer(
+    const chrono::nanoseconds time_point) {
+  RST_DCHECK(timer_fd_ != -1);
+
+  // Zero value disarms the timer.
+  const auto ns = std::max(time_point.count(), chrono::nanoseconds::rep{1});
+  itimerspec spec = {};
+  spec.it_value.tv_sec =
+      static_cast<decltype(spec.it_value.tv_sec)>(ns / 1'000'000'000);
+  spec.it_value.tv_nsec =
+      static_cast<decltype(spec.it_value.tv_nsec)>(ns % 1'000'000'000);
+  RST_CHECK(timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) ==
+            0);
+}
+#endif  // RST_BUILDFLAG(OS_LINUX)
+
 void ThreadPoolTaskRunner::ServiceTaskRunner::PushTask(
     std::function<void()>&& task, const std::chrono::nanoseconds delay,
     const size_t iterations) {
@@ -243,9 +346,22 @@ void ThreadPoolTaskRunner::ServiceTaskRunner::PushTask(
   const auto future_time_point = now + delay;
   {
     std::lock_guard lock(thread_mutex_);
-    delayed_tasks_.emplace_back(std::move(task), future_time_point, task_id_++,
+    const auto task_id = task_id_++;
+    delayed_tasks_.emplace_back(std::move(task), future_time_point, task_id,
                                 iterations);
     c_push_heap(delayed_tasks_, std::greater<>());
+
+    // The service thread needs to be woken up only if the new task is the
+    // earliest one.
+    if (delayed_tasks_.front().task_id != task_id)
+      return;
+
+#if RST_BUILDFLAG(OS_LINUX)
+    if (timer_fd_ != -1) {
+      ArmTimer(future_time_point);
+      return;
+    }
+#endif  // RST_BUILDFLAG(OS_LINUX)
   }
 
   thread_cv_.notify_one();
@@ -256,7 +372,14 @@ ThreadPoolTaskRunner::ThreadPoolTaskRunner(
     std::function<chrono::nanoseconds()>&& time_function,
     const std::chrono::nanoseconds keep_alive_time)
     : delayed_task_runner_(max_threads_num, keep_alive_time),
-      service_task_runner_(&delayed_task_runner_, std::move(time_function)) {}
+      service_task_runner_(&delayed_task_runner_, std::move(time_function),
+                           false) {}
+
+ThreadPoolTaskRunner::ThreadPoolTaskRunner(
+    const size_t max_threads_num, const chrono::nanoseconds keep_alive_time)
+    : delayed_task_runner_(max_threads_num, keep_alive_time),
+      service_task_runner_(&delayed_task_runner_, &MonotonicTime,
+                           RST_BUILDFLAG(OS_LINUX)) {}
 
 ThreadPoolTaskRunner::~ThreadPoolTaskRunner() = default;
 
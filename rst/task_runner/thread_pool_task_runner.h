@@ -40,6 +40,7 @@
 #include <vector>
 
 #include "rst/macros/macros.h"
+#include "rst/macros/os.h"
 #include "rst/not_null/not_null.h"
 #include "rst/task_runner/item.h"
 #include "rst/task_runner/iteration_item.h"
@@ -60,6 +61,10 @@ namespace rst {
 //   rst::ThreadPoolTaskRunner task_runner(max_threads_num,
 //                                         std::move(time_function),
 //                                         keep_alive_time);
+//   // Or uses the monotonic clock. On Linux delayed tasks are scheduled with
+//   // an absolute deadline timer (timerfd), so they run within microseconds
+//   // after their time comes.
+//   rst::ThreadPoolTaskRunner task_runner(max_threads_num, keep_alive_time);
 //   ...
 //   std::function<void()> task = ...;
 //   task_runner.PostTask(std::move(task));
@@ -82,6 +87,11 @@ class ThreadPoolTaskRunner : public TaskRunner {
       size_t max_threads_num,
       std::function<std::chrono::nanoseconds()>&& time_function,
       std::chrono::nanoseconds keep_alive_time);
+  // Like the constructor above but uses the monotonic clock as the time
+  // function. On Linux delayed tasks are scheduled with an absolute deadline
+  // timer (timerfd), so they run within microseconds after their time comes.
+  ThreadPoolTaskRunner(size_t max_threads_num,
+                       std::chrono::nanoseconds keep_alive_time);
   ~ThreadPoolTaskRunner() override;
 
  private:
@@ -118,9 +128,12 @@ class ThreadPoolTaskRunner : public TaskRunner {
 
   class ServiceTaskRunner {
    public:
+    // If |use_timer_fd| is set, |time_function| must return the time of the
+    // monotonic clock.
     ServiceTaskRunner(
         NotNull<DelayedTaskRunner*> delayed_task_runner,
-        std::function<std::chrono::nanoseconds()>&& time_function);
+        std::function<std::chrono::nanoseconds()>&& time_function,
+        bool use_timer_fd);
     ~ServiceTaskRunner();
 
     void PushTask(std::function<void()>&& task, std::chrono::nanoseconds delay,
@@ -128,6 +141,15 @@ class ThreadPoolTaskRunner : public TaskRunner {
 
    private:
     void WaitAndScheduleTasks();
+    // Moves the tasks which time has come from |delayed_tasks_| to |tasks|.
+    void TakeDueTasks(NotNull<std::vector<internal::IterationItem>*> tasks);
+
+#if RST_BUILDFLAG(OS_LINUX)
+    void WaitAndScheduleTasksWithTimerFd();
+    // Arms |timer_fd_| to expire at the absolute |time_point| of the monotonic
+    // clock.
+    void ArmTimer(std::chrono::nanoseconds time_point);
+#endif  // RST_BUILDFLAG(OS_LINUX)
 
     std::condition_variable thread_cv_;
     std::mutex thread_mutex_;
@@ -145,6 +167,12 @@ class ThreadPoolTaskRunner : public TaskRunner {
 
     bool should_exit_ = false;
 
+#if RST_BUILDFLAG(OS_LINUX)
+    // Timer that wakes up the service thread when the earliest delayed task
+    // should run. -1 if the condition variable is used instead.
+    const int timer_fd_;
+#endif  // RST_BUILDFLAG(OS_LINUX)
+
     std::thread thread_;
 
     RST_DISALLOW_COPY_AND_ASSIGN(ServiceTaskRunner);
@@ -237,6 +237,43 @@ TEST(ThreadPoolTaskRunner, ApplyTaskSync) {
   }
 }
 
+TEST(ThreadPoolTaskRunner, MonotonicClockPostDelayedTask) {
+  std::mutex mtx;
+  ThreadPoolTaskRunner task_runner(1, chrono::seconds(60));
+
+  const auto start = chrono::steady_clock::now();
+  std::vector<int> result, expected;
+  std::vector<chrono::steady_clock::duration> elapsed;
+  for (auto i = 4; i >= 0; i--) {
+    task_runner.PostDelayedTask(
+        [i, start, &mtx, &result, &elapsed]() {
+          std::lock_guard lock(mtx);
+          result.emplace_back(i);
+          elapsed.emplace_back(chrono::steady_clock::now() - start);
+        },
+        chrono::milliseconds(10 * (i + 1)));
+  }
+
+  task_runner.PostDelayedTask(
+      [&mtx, &result]() {
+        std::lock_guard lock(mtx);
+        result.emplace_back(-1);
+      },
+      chrono::milliseconds(5));
+
+  expected = {-1, 0, 1, 2, 3, 4};
+  while (true) {
+    std::lock_guard lock(mtx);
+    if (result.size() == expected.size())
+      break;
+  }
+
+  EXPECT_EQ(result, expected);
+  ASSERT_EQ(elapsed.size(), 5U);
+  for (size_t i = 0; i < elapsed.size(); i++)
+    EXPECT_GE(elapsed[i], chrono::milliseconds(10 * (i + 1)));
+}
+
 TEST(ThreadPoolTaskRunner, CrashOnZeroIteration) {
   ThreadPoolTaskRunner task_runner(
       1, []() -> chrono::nanoseconds { return chrono::nanoseconds(0); },
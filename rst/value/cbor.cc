@@ -0,0 +1,537 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/cbor.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rst/check/check.h"
+#include "rst/macros/optimization.h"
+#include "rst/status/status_macros.h"
+#include "rst/strings/str_cat.h"
+
+namespace rst {
+namespace {
+
+// Major types.
+constexpr uint8_t kUnsignedInteger = 0;
+constexpr uint8_t kNegativeInteger = 1;
+constexpr uint8_t kByteString = 2;
+constexpr uint8_t kTextString = 3;
+constexpr uint8_t kArray = 4;
+constexpr uint8_t kMap = 5;
+constexpr uint8_t kTag = 6;
+constexpr uint8_t kSimpleOrFloat = 7;
+
+// Additional information of the major type 7.
+constexpr uint8_t kFalse = 20;
+constexpr uint8_t kTrue = 21;
+constexpr uint8_t kNull = 22;
+constexpr uint8_t kHalfFloat = 25;
+constexpr uint8_t kSingleFloat = 26;
+constexpr uint8_t kDoubleFloat = 27;
+
+constexpr uint8_t kIndefiniteLength = 31;
+
+// The stringref extension tags.
+constexpr uint64_t kStringRefNamespaceTag = 256;
+constexpr uint64_t kStringRefTag = 25;
+
+constexpr int64_t kMaxSafeInteger =
+    (int64_t{1} << std::numeric_limits<double>::digits) - 1;
+
+// Returns true if a string of |size| bytes gets an index when |count| strings
+// have been indexed, i.e. if the reference is shorter than the string.
+constexpr bool IsStringRefEligible(const size_t size, const size_t count) {
+  if (count < 24)
+    return size >= 3;
+  if (count < 256)
+    return size >= 4;
+  if (count < 65536)
+    return size >= 5;
+  if (count < (uint64_t{1} << 32))
+    return size >= 7;
+  return size >= 11;
+}
+
+template <class To, class From>
+To BitCast(const From from) {
+  static_assert(sizeof(To) == sizeof(From));
+  To to;
+  std::memcpy(&to, &from, sizeof(to));
+  return to;
+}
+
+double DecodeHalfFloat(const uint16_t half) {
+  const int exponent = (half >> 10) & 0x1f;
+  const int mantissa = half & 0x3ff;
+  double result = 0.0;
+  if (exponent == 0)
+    result = std::ldexp(mantissa, -24);
+  else if (exponent != 31)
+    result = std::ldexp(mantissa + 1024, exponent - 25);
+  else
+    result = mantissa == 0 ? std::numeric_limits<double>::infinity()
+                           : std::numeric_limits<double>::quiet_NaN();
+  return (half & 0x8000) ? -result : result;
+}
+
+class CborWriter {
+ public:
+  CborWriter(const NotNull<std::string*> out, const bool deduplicate_strings)
+      : out_(out), deduplicate_strings_(deduplicate_strings) {}
+
+  void Write(const Value& value) {
+    if (deduplicate_strings_)
+      WriteHead(kTag, kStringRefNamespaceTag);
+    WriteValue(value);
+  }
+
+ private:
+  void WriteHead(const uint8_t major_type, const uint64_t argument) {
+    const auto initial_byte = static_cast<char>(major_type << 5);
+    if (argument < 24) {
+      *out_ += static_cast<char>(initial_byte | argument);
+    } else if (argument <= std::numeric_limits<uint8_t>::max()) {
+      *out_ += static_cast<char>(initial_byte | 24);
+      WriteBigEndian(argument, 1);
+    } else if (argument <= std::numeric_limits<uint16_t>::max()) {
+      *out_ += static_cast<char>(initial_byte | 25);
+      WriteBigEndian(argument, 2);
+    } else if (argument <= std::numeric_limits<uint32_t>::max()) {
+      *out_ += static_cast<char>(initial_byte | 26);
+      WriteBigEndian(argument, 4);
+    } else {
+      *out_ += static_cast<char>(initial_byte | 27);
+      WriteBigEndian(argument, 8);
+    }
+  }
+
+  void WriteBigEndian(const uint64_t value, const size_t size) {
+    for (auto i = size; i > 0; i--)
+      *out_ += static_cast<char>(value >> ((i - 1) * 8));
+  }
+
+  void WriteValue(const Value& value) {
+    switch (value.type()) {
+      case Value::Type::kNull:
+        WriteHead(kSimpleOrFloat, kNull);
+        return;
+      case Value::Type::kBool:
+        WriteHead(kSimpleOrFloat, value.GetBool() ? kTrue : kFalse);
+        return;
+      case Value::Type::kNumber:
+        WriteNumber(value);
+        return;
+      case Value::Type::kString:
+        WriteString(value.GetString());
+        return;
+      case Value::Type::kArray:
+        WriteHead(kArray, value.GetArray().size());
+        for (const auto& element : value.GetArray())
+          WriteValue(element);
+        return;
+      case Value::Type::kObject:
+        WriteHead(kMap, value.GetObject().size());
+        for (const auto& [key, member] : value.GetObject()) {
+          WriteString(key);
+          WriteValue(member);
+        }
+        return;
+    }
+  }
+
+  void WriteNumber(const Value& value) {
+    if (value.IsInt64()) {
+      const auto integer = value.GetInt64();
+      if (integer >= 0)
+        WriteHead(kUnsignedInteger, static_cast<uint64_t>(integer));
+      else
+        WriteHead(kNegativeInteger, static_cast<uint64_t>(-1 - integer));
+      return;
+    }
+
+    const auto number = value.GetDouble();
+    // Narrowing a double outside the float range is undefined behavior.
+    if (std::fabs(number) <=
+        static_cast<double>(std::numeric_limits<float>::max())) {
+      const auto single = static_cast<float>(number);
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wfloat-equal"
+      if (static_cast<double>(single) == number) {
+#pragma clang diagnostic pop
+        *out_ += static_cast<char>((kSimpleOrFloat << 5) | kSingleFloat);
+        WriteBigEndian(BitCast<uint32_t>(single), sizeof(uint32_t));
+        return;
+      }
+    }
+
+    *out_ += static_cast<char>((kSimpleOrFloat << 5) | kDoubleFloat);
+    WriteBigEndian(BitCast<uint64_t>(number), sizeof(uint64_t));
+  }
+
+  void WriteString(const std::string_view string) {
+    if (deduplicate_strings_) {
+      const auto it = string_indices_.find(string);
+      if (it != string_indices_.cend()) {
+        WriteHead(kTag, kStringRefTag);
+        WriteHead(kUnsignedInteger, it->second);
+        return;
+      }
+
+      if (IsStringRefEligible(string.size(), string_indices_.size()))
+        string_indices_.emplace(string, string_indices_.size());
+    }
+
+    WriteHead(kTextString, string.size());
+    out_->append(string);
+  }
+
+  const NotNull<std::string*> out_;
+  const bool deduplicate_strings_;
+  // Indices of the strings of the value being written.
+  std::unordered_map<std::string_view, size_t> string_indices_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(CborWriter);
+};
+
+// Recursive descent decoder. Reading functions return false on error and
+// store the error message and position.
+class CborReader {
+ public:
+  CborReader(const std::string_view cbor, const NotNull<JsonHandler*> handler,
+             const size_t max_depth)
+      : begin_(cbor.data()),
+        current_(cbor.data()),
+        end_(cbor.data() + cbor.size()),
+        handler_(handler),
+        max_depth_(max_depth) {}
+
+  Status Read() {
+    if (!ReadItem(0, false))
+      return MakeError();
+
+    if (current_ != end_) {
+      Fail("Unexpected data after root value");
+      return MakeError();
+    }
+
+    return Status::OK();
+  }
+
+ private:
+  bool Fail(const std::string_view message) {
+    error_message_ = message;
+    return false;
+  }
+
+  // Stores an error of the handler.
+  bool Fail(Status status) {
+    handler_status_.emplace(std::move(status));
+    return false;
+  }
+
+  Status MakeError() {
+    if (handler_status_.has_value())
+      return std::move(*handler_status_);
+
+    return MakeStatus<CborParseError>(error_message_,
+                                      static_cast<size_t>(current_ - begin_));
+  }
+
+  bool Call(Status status) {
+    if (status.err())
+      return Fail(std::move(status));
+    return true;
+  }
+
+  bool ReadBigEndian(const size_t size, const NotNull<uint64_t*> value) {
+    if (RST_UNLIKELY(static_cast<size_t>(end_ - current_) < size))
+      return Fail("Unexpected end of input");
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < size; i++, current_++)
+      result = (result << 8) | static_cast<uint8_t>(*current_);
+
+    *value = result;
+    return true;
+  }
+
+  // Reads an initial byte and its argument.
+  bool ReadHead(const NotNull<uint8_t*> major_type,
+                const NotNull<uint8_t*> additional_info,
+                const NotNull<uint64_t*> argument) {
+    if (RST_UNLIKELY(current_ == end_))
+      return Fail("Unexpected end of input");
+
+    const auto initial_byte = static_cast<uint8_t>(*current_);
+    *major_type = initial_byte >> 5;
+    *additional_info = initial_byte & 0x1f;
+    if (*additional_info < 24) {
+      current_++;
+      *argument = *additional_info;
+      return true;
+    }
+
+    switch (*additional_info) {
+      case 24:
+      case 25:
+      case 26:
+      case 27:
+        current_++;
+        return ReadBigEndian(size_t{1} << (*additional_info - 24), argument);
+      case kIndefiniteLength:
+        return Fail("Indefinite lengths are not supported");
+      default:
+        return Fail("Invalid additional information");
+    }
+  }
+
+  bool ReadItem(const size_t depth, const bool is_key) {
+    const auto item_begin = current_;
+    uint8_t major_type = 0;
+    uint8_t additional_info = 0;
+    uint64_t argument = 0;
+    if (!ReadHead(&major_type, &additional_info, &argument))
+      return false;
+
+    if (is_key && major_type != kTextString && major_type != kTag) {
+      current_ = item_begin;
+      return Fail("Expected text key");
+    }
+
+    switch (major_type) {
+      case kUnsignedInteger: {
+        if (argument <= static_cast<uint64_t>(kMaxSafeInteger)) {
+          return Call(
+              handler_->OnNumber(Value(static_cast<int64_t>(argument))));
+        }
+        return Call(handler_->OnNumber(Value(static_cast<double>(argument))));
+      }
+      case kNegativeInteger: {
+        if (argument < static_cast<uint64_t>(kMaxSafeInteger)) {
+          return Call(handler_->OnNumber(
+              Value(-1 - static_cast<int64_t>(argument))));
+        }
+        return Call(
+            handler_->OnNumber(Value(-1.0 - static_cast<double>(argument))));
+      }
+      case kByteString: {
+        current_ = item_begin;
+        return Fail("Byte strings are not supported");
+      }
+      case kTextString: {
+        if (RST_UNLIKELY(static_cast<uint64_t>(end_ - current_) < argument))
+          return Fail("Unexpected end of input");
+
+        const std::string_view string(current_, static_cast<size_t>(argument));
+        current_ += argument;
+        if (is_string_ref_namespace_ &&
+            IsStringRefEligible(string.size(), strings_.size())) {
+          strings_.emplace_back(string);
+        }
+        return OnString(string, is_key);
+      }
+      case kArray: {
+        if (depth >= max_depth_) {
+          current_ = item_begin;
+          return Fail("Too deep nesting");
+        }
+
+        if (!Call(handler_->OnStartArray()))
+          return false;
+        for (uint64_t i = 0; i < argument; i++) {
+          if (!ReadItem(depth + 1, false))
+            return false;
+        }
+        return Call(handler_->OnEndArray());
+      }
+      case kMap: {
+        if (depth >= max_depth_) {
+          current_ = item_begin;
+          return Fail("Too deep nesting");
+        }
+
+        if (!Call(handler_->OnStartObject()))
+          return false;
+        for (uint64_t i = 0; i < argument; i++) {
+          if (!ReadItem(depth + 1, true))
+            return false;
+          if (!ReadItem(depth + 1, false))
+            return false;
+        }
+        return Call(handler_->OnEndObject());
+      }
+      case kTag: {
+        if (depth >= max_depth_) {
+          current_ = item_begin;
+          return Fail("Too deep nesting");
+        }
+
+        if (argument == kStringRefTag)
+          return ReadStringRef(item_begin, is_key);
+
+        if (is_key) {
+          current_ = item_begin;
+          return Fail("Expected text key");
+        }
+
+        if (argument != kStringRefNamespaceTag)
+          return ReadItem(depth + 1, false);
+
+        // Strings of a nested namespace are indexed separately.
+        auto strings = std::move(strings_);
+        const auto is_string_ref_namespace = is_string_ref_namespace_;
+        strings_.clear();
+        is_string_ref_namespace_ = true;
+        if (!ReadItem(depth + 1, false))
+          return false;
+        strings_ = std::move(strings);
+        is_string_ref_namespace_ = is_string_ref_namespace;
+        return true;
+      }
+      case kSimpleOrFloat: {
+        return ReadSimpleOrFloat(item_begin, additional_info, argument);
+      }
+    }
+
+    RST_NOTREACHED();
+    return false;
+  }
+
+  bool ReadStringRef(const char* const item_begin, const bool is_key) {
+    uint8_t major_type = 0;
+    uint8_t additional_info = 0;
+    uint64_t index = 0;
+    if (!ReadHead(&major_type, &additional_info, &index))
+      return false;
+
+    if (!is_string_ref_namespace_ || major_type != kUnsignedInteger ||
+        index >= strings_.size()) {
+      current_ = item_begin;
+      return Fail("Invalid string reference");
+    }
+
+    return OnString(strings_[index], is_key);
+  }
+
+  bool ReadSimpleOrFloat(const char* const item_begin,
+                         const uint8_t additional_info,
+                         const uint64_t argument) {
+    double number = 0.0;
+    switch (additional_info) {
+      case kFalse:
+        return Call(handler_->OnBool(false));
+      case kTrue:
+        return Call(handler_->OnBool(true));
+      case kNull:
+        return Call(handler_->OnNull());
+      case kHalfFloat:
+        number = DecodeHalfFloat(static_cast<uint16_t>(argument));
+        break;
+      case kSingleFloat:
+        number = BitCast<float>(static_cast<uint32_t>(argument));
+        break;
+      case kDoubleFloat:
+        number = BitCast<double>(argument);
+        break;
+      default:
+        current_ = item_begin;
+        return Fail("Unsupported simple value");
+    }
+
+    if (!std::isfinite(number)) {
+      current_ = item_begin;
+      return Fail("Non-finite number");
+    }
+
+    return Call(handler_->OnNumber(Value(number)));
+  }
+
+  bool OnString(const std::string_view string, const bool is_key) {
+    if (is_key)
+      return Call(handler_->OnKey(string));
+    return Call(handler_->OnString(string));
+  }
+
+  const char* const begin_;
+  const char* current_;
+  const char* const end_;
+  const NotNull<JsonHandler*> handler_;
+  const size_t max_depth_;
+
+  // Strings indexed in the current stringref namespace.
+  bool is_string_ref_namespace_ = false;
+  std::vector<std::string_view> strings_;
+
+  std::string_view error_message_;
+  std::optional<Status> handler_status_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(CborReader);
+};
+
+}  // namespace
+
+char CborParseError::id_ = '\0';
+
+CborParseError::CborParseError(const std::string_view message,
+                               const size_t offset)
+    : message_(StrCat({message, " at offset ", offset})), offset_(offset) {}
+
+CborParseError::~CborParseError() = default;
+
+const std::string& CborParseError::AsString() const { return message_; }
+
+void WriteCbor(const Value& value, const NotNull<std::string*> out,
+               const CborDeduplicateStrings deduplicate_strings) {
+  CborWriter writer(out, deduplicate_strings.value());
+  writer.Write(value);
+}
+
+Status ReadCbor(const std::string_view cbor,
+                const NotNull<JsonHandler*> handler,
+                const CborMaxDepth max_depth) {
+  CborReader reader(cbor, handler, max_depth.value());
+  return reader.Read();
+}
+
+StatusOr<Value> ParseCbor(const std::string_view cbor,
+                          const CborMaxDepth max_depth) {
+  JsonValueBuilder builder;
+  RST_TRY(ReadCbor(cbor, &builder, max_depth));
+  RST_DCHECK(builder.HasValue());
+  return builder.TakeValue();
+}
+
+}  // namespace rst
@@ -0,0 +1,113 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_CBOR_H_
+#define RST_VALUE_CBOR_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/status/status_or.h"
+#include "rst/type/type.h"
+#include "rst/value/json_stream_parser.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+class CborParseError final : public ErrorInfo<CborParseError> {
+ public:
+  CborParseError(std::string_view message, size_t offset);
+  ~CborParseError() override;
+
+  // ErrorInfo:
+  const std::string& AsString() const override;
+
+  // Returns the byte offset in the input where the error has been detected.
+  size_t offset() const { return offset_; }
+
+  static char id_;
+
+ private:
+  const std::string message_;
+  const size_t offset_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(CborParseError);
+};
+
+// If set, repeated strings, e.g. object keys, are written once and then
+// referenced by index (the stringref extension, tags 256 and 25).
+using CborDeduplicateStrings = Type<class CborDeduplicateStringsTag, bool>;
+
+using CborMaxDepth = Type<class CborMaxDepthTag, size_t>;
+
+// Appends the CBOR (RFC 8949) representation of |value| to |out|. Arrays,
+// objects and strings are prefixed with their lengths, integers are written
+// as CBOR integers and other numbers as single or double precision floats,
+// whichever is exact.
+//
+// Example:
+//
+//   #include "rst/value/cbor.h"
+//
+//   const rst::Value& value = ...;
+//   std::string cbor;
+//   rst::WriteCbor(value, &cbor, rst::CborDeduplicateStrings(true));
+//
+void WriteCbor(
+    const Value& value, NotNull<std::string*> out,
+    CborDeduplicateStrings deduplicate_strings = CborDeduplicateStrings(false));
+
+// Decodes a single CBOR data item in one pass and calls |handler| for its
+// contents like `rst::JsonStreamParser` does. Strings are passed as views into
+// |cbor|. Supports the data items that `rst::Value` can represent: integers,
+// floats, text strings, arrays, maps with text keys, booleans and null, with
+// definite lengths only. Integers beyond 2^53 - 1 are converted to doubles.
+// Other tags than the stringref ones are skipped. Returns
+// `rst::CborParseError` with the byte offset of the error if the input is
+// malformed or unsupported, or nests arrays and maps deeper than |max_depth|.
+Status ReadCbor(std::string_view cbor, NotNull<JsonHandler*> handler,
+                CborMaxDepth max_depth = CborMaxDepth(200));
+
+// Like `rst::ReadCbor()` but returns the decoded `rst::Value`. Duplicate map
+// keys are allowed, the last one wins.
+//
+// Example:
+//
+//   #include "rst/value/cbor.h"
+//
+//   rst::StatusOr<rst::Value> value = rst::ParseCbor(cbor);
+//
+StatusOr<Value> ParseCbor(std::string_view cbor,
+                          CborMaxDepth max_depth = CborMaxDepth(200));
+
+}  // namespace rst
+
+#endif  // RST_VALUE_CBOR_H_
@@ -0,0 +1,190 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/cbor.h"
+
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+std::string Write(const Value& value, const bool deduplicate_strings = false) {
+  std::string cbor;
+  WriteCbor(value, &cbor, CborDeduplicateStrings(deduplicate_strings));
+  return cbor;
+}
+
+Value Parse(const std::string_view cbor) {
+  auto value = ParseCbor(cbor);
+  RST_CHECK(!value.err());
+  return std::move(*value);
+}
+
+size_t ErrorOffset(const std::string_view cbor,
+                   const CborMaxDepth max_depth = CborMaxDepth(200)) {
+  return GetErrorOffset<CborParseError>(ParseCbor(cbor, max_depth));
+}
+
+// Records the data of the strings.
+class StringHandler : public JsonHandler {
+ public:
+  Status OnNull() override { return Status::OK(); }
+  Status OnBool(bool) override { return Status::OK(); }
+  Status OnNumber(const Value&) override { return Status::OK(); }
+  Status OnStartArray() override { return Status::OK(); }
+  Status OnEndArray() override { return Status::OK(); }
+  Status OnStartObject() override { return Status::OK(); }
+  Status OnEndObject() override { return Status::OK(); }
+  Status OnString(const std::string_view value) override {
+    strings_.emplace_back(value.data());
+    return Status::OK();
+  }
+  Status OnKey(const std::string_view key) override {
+    strings_.emplace_back(key.data());
+    return Status::OK();
+  }
+
+  const std::vector<const char*>& strings() const { return strings_; }
+
+ private:
+  std::vector<const char*> strings_;
+};
+
+}  // namespace
+
+TEST(Cbor, Write) {
+  using namespace std::string_view_literals;
+  EXPECT_EQ(Write(Value(0)), "\x00"sv);
+  EXPECT_EQ(Write(Value(23)), "\x17");
+  EXPECT_EQ(Write(Value(24)), "\x18\x18");
+  EXPECT_EQ(Write(Value(1000)), "\x19\x03\xe8");
+  EXPECT_EQ(Write(Value(1000000)), "\x1a\x00\x0f\x42\x40"sv);
+  EXPECT_EQ(Write(Value(int64_t{1} << 40)),
+            "\x1b\x00\x00\x01\x00\x00\x00\x00\x00"sv);
+  EXPECT_EQ(Write(Value(-1)), "\x20");
+  EXPECT_EQ(Write(Value(-1000)), "\x39\x03\xe7");
+  EXPECT_EQ(Write(Value(2.0)), "\x02");
+  EXPECT_EQ(Write(Value(1.5)), "\xfa\x3f\xc0\x00\x00"sv);
+  EXPECT_EQ(Write(Value(1.1)), "\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a");
+  EXPECT_EQ(Write(Value(double{std::numeric_limits<float>::max()})),
+            "\xfa\x7f\x7f\xff\xff");
+  EXPECT_EQ(Write(Value(1e300)), "\xfb\x7e\x37\xe4\x3c\x88\x00\x75\x9c"sv);
+  EXPECT_EQ(Write(Value(-1e300)), "\xfb\xfe\x37\xe4\x3c\x88\x00\x75\x9c"sv);
+  EXPECT_EQ(Write(Value(false)), "\xf4");
+  EXPECT_EQ(Write(Value(true)), "\xf5");
+  EXPECT_EQ(Write(Value()), "\xf6");
+  EXPECT_EQ(Write(Value("")), "\x60");
+  EXPECT_EQ(Write(Value("a")), "\x61\x61");
+  EXPECT_EQ(Write(ParseJsonOrDie("[]")), "\x80");
+  EXPECT_EQ(Write(ParseJsonOrDie("[1, [2, 3]]")), "\x82\x01\x82\x02\x03");
+  EXPECT_EQ(Write(ParseJsonOrDie(R"({"a": 1, "b": [2]})")),
+            "\xa2\x61\x61\x01\x61\x62\x81\x02");
+}
+
+TEST(Cbor, Read) {
+  using namespace std::string_view_literals;
+  EXPECT_EQ(Parse("\x00"sv), Value(0));
+  EXPECT_EQ(Parse("\x18\x64"), Value(100));
+  EXPECT_EQ(Parse("\x39\x03\xe7"), Value(-1000));
+  EXPECT_EQ(Parse("\x1b\xff\xff\xff\xff\xff\xff\xff\xff").GetDouble(),
+            18446744073709551615.0);
+  EXPECT_EQ(Parse("\x3b\x00\x20\x00\x00\x00\x00\x00\x00"sv).GetDouble(),
+            -9007199254740993.0);
+  EXPECT_EQ(Parse("\xf9\x3e\x00"sv), Value(1.5));
+  EXPECT_EQ(Parse("\xf9\x7b\xff"), Value(65504));
+  EXPECT_EQ(Parse("\xf9\x00\x01"sv).GetDouble(), 5.960464477539063e-8);
+  EXPECT_EQ(Parse("\xfa\x47\xc3\x50\x00"sv), Value(100000));
+  EXPECT_EQ(Parse("\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a"), Value(1.1));
+  EXPECT_EQ(Parse("\xf6"), Value());
+  EXPECT_EQ(Parse("\x63\x61\x62\x63").GetString(), "abc");
+  EXPECT_EQ(Parse("\xc1\x01"), Value(1));
+  EXPECT_EQ(Parse("\xa2\x61\x62\x01\x61\x61\x80"),
+            ParseJsonOrDie(R"({"a": [], "b": 1})"));
+}
+
+TEST(Cbor, RoundTrip) {
+  const auto value = ParseJsonOrDie(
+      R"({"a": [1, -2, 3.5, 1e300, -0.0, true, false, null], )"
+      R"("b": {"c": "string", "d": {}}, "e": [], "f": 9007199254740991})");
+  EXPECT_EQ(Parse(Write(value)), value);
+  EXPECT_EQ(Parse(Write(value, true)), value);
+}
+
+TEST(Cbor, DeduplicateStrings) {
+  using namespace std::string_view_literals;
+  const auto value = ParseJsonOrDie(R"(["abc", "abc", "ab", "ab"])");
+  EXPECT_EQ(Write(value, true),
+            "\xd9\x01\x00\x84\x63\x61\x62\x63\xd8\x19\x00\x62\x61\x62\x62\x61"
+            "\x62"sv);
+
+  const auto records = ParseJsonOrDie(
+      R"([{"identifier": 1, "name": "a"}, {"identifier": 2, "name": "b"}])");
+  const auto cbor = Write(records, true);
+  EXPECT_LT(cbor.size(), Write(records).size());
+  EXPECT_EQ(Parse(cbor), records);
+}
+
+TEST(Cbor, ZeroCopyStrings) {
+  const auto cbor = Write(ParseJsonOrDie(R"({"key": ["value", "key"]})"), true);
+  StringHandler handler;
+  auto status = ReadCbor(cbor, &handler);
+  ASSERT_FALSE(status.err());
+  ASSERT_EQ(handler.strings().size(), 3U);
+  for (const auto string : handler.strings()) {
+    EXPECT_GE(string, cbor.data());
+    EXPECT_LT(string, cbor.data() + cbor.size());
+  }
+  EXPECT_EQ(handler.strings()[0], handler.strings()[2]);
+}
+
+TEST(Cbor, Errors) {
+  using namespace std::string_view_literals;
+  EXPECT_EQ(ErrorOffset(""), 0U);
+  EXPECT_EQ(ErrorOffset("\x00\x00"sv), 1U);
+  EXPECT_EQ(ErrorOffset("\x82\x01"), 2U);
+  EXPECT_EQ(ErrorOffset("\x19\x01"), 1U);
+  EXPECT_EQ(ErrorOffset("\x62\x61"), 1U);
+  EXPECT_EQ(ErrorOffset("\x81\x41\x61"), 1U);
+  EXPECT_EQ(ErrorOffset("\x9f\xff"), 0U);
+  EXPECT_EQ(ErrorOffset("\x1c"), 0U);
+  EXPECT_EQ(ErrorOffset("\xa1\x01\x01"), 1U);
+  EXPECT_EQ(ErrorOffset("\xf7"), 0U);
+  EXPECT_EQ(ErrorOffset("\x81\xf9\x7c\x00"sv), 1U);
+  EXPECT_EQ(ErrorOffset("\xd8\x19\x00"sv), 0U);
+  EXPECT_EQ(ErrorOffset("\xd9\x01\x00\x82\x61\x61\xd8\x19\x00"sv), 6U);
+  EXPECT_EQ(ErrorOffset("\x81\x81\x80", CborMaxDepth(2)), 2U);
+}
+
+}  // namespace rst
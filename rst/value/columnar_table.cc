@@ -0,0 +1,349 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/columnar_table.h"
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "rst/strings/str_cat.h"
+
+namespace rst {
+namespace {
+
+// A column inferred from the members of the rows.
+struct ColumnSchema {
+  std::string_view name;
+  // Empty until the first non-null member.
+  std::optional<ColumnarTable::ColumnType> type;
+};
+
+ColumnarTable::ColumnType GetColumnType(const Value& value) {
+  switch (value.type()) {
+    case Value::Type::kBool:
+      return ColumnarTable::ColumnType::kBool;
+    case Value::Type::kNumber:
+      return value.IsInt64() ? ColumnarTable::ColumnType::kInt64
+                             : ColumnarTable::ColumnType::kDouble;
+    case Value::Type::kString:
+      return ColumnarTable::ColumnType::kString;
+    case Value::Type::kNull:
+    case Value::Type::kArray:
+    case Value::Type::kObject:
+      return ColumnarTable::ColumnType::kValue;
+  }
+
+  RST_NOTREACHED();
+  return ColumnarTable::ColumnType::kValue;
+}
+
+// Widens the type of |column| so that it can hold |member|.
+void MergeColumnType(const Value& member, const NotNull<ColumnSchema*> column) {
+  if (member.IsNull())
+    return;
+
+  const auto type = GetColumnType(member);
+  if (!column->type.has_value() || *column->type == type) {
+    column->type = type;
+    return;
+  }
+
+  const auto is_number = [](const ColumnarTable::ColumnType type) {
+    return type == ColumnarTable::ColumnType::kInt64 ||
+           type == ColumnarTable::ColumnType::kDouble;
+  };
+  if (is_number(*column->type) && is_number(type)) {
+    column->type = ColumnarTable::ColumnType::kDouble;
+    return;
+  }
+
+  column->type = ColumnarTable::ColumnType::kValue;
+}
+
+// Sums into independent partial sums to overlap the additions.
+template <class T>
+double SumOf(const std::vector<T>& data) {
+  double sums[4] = {};
+  size_t i = 0;
+  for (; i + 4 <= data.size(); i += 4) {
+    sums[0] += static_cast<double>(data[i]);
+    sums[1] += static_cast<double>(data[i + 1]);
+    sums[2] += static_cast<double>(data[i + 2]);
+    sums[3] += static_cast<double>(data[i + 3]);
+  }
+
+  for (; i < data.size(); i++)
+    sums[0] += static_cast<double>(data[i]);
+
+  return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+}  // namespace
+
+char ColumnarTableError::id_ = '\0';
+
+ColumnarTableError::ColumnarTableError(const std::string_view message,
+                                       const size_t index)
+    : message_(StrCat({message, " at index ", index})), index_(index) {}
+
+ColumnarTableError::~ColumnarTableError() = default;
+
+const std::string& ColumnarTableError::AsString() const { return message_; }
+
+ColumnarTable::Column::Column(const std::string_view name,
+                              const ColumnType type, const size_t size)
+    : name_(name),
+      type_(type),
+      size_(size),
+      null_bitmap_((size + 63) / 64, ~uint64_t{0}),
+      null_count_(size) {
+  switch (type_) {
+    case ColumnType::kBool:
+      bools_.resize(size);
+      return;
+    case ColumnType::kInt64:
+      int64s_.resize(size);
+      return;
+    case ColumnType::kDouble:
+      doubles_.resize(size);
+      return;
+    case ColumnType::kString:
+      strings_.resize(size);
+      return;
+    case ColumnType::kValue:
+      values_.resize(size);
+      return;
+  }
+
+  RST_NOTREACHED();
+}
+
+ColumnarTable::Column::~Column() = default;
+
+ColumnarTable::Column::Column(Column&&) noexcept = default;
+
+ColumnarTable::Column& ColumnarTable::Column::operator=(Column&&) noexcept =
+    default;
+
+void ColumnarTable::Column::Set(const size_t row, const Value& value) {
+  RST_DCHECK(row < size_);
+  RST_DCHECK(IsNull(row));
+  if (value.IsNull())
+    return;
+
+  switch (type_) {
+    case ColumnType::kBool:
+      bools_[row] = value.GetBool();
+      break;
+    case ColumnType::kInt64:
+      int64s_[row] = value.GetInt64();
+      break;
+    case ColumnType::kDouble:
+      doubles_[row] = value.GetDouble();
+      break;
+    case ColumnType::kString: {
+      const auto& string = value.GetString();
+      strings_[row].assign(string.data(), string.size());
+      break;
+    }
+    case ColumnType::kValue:
+      values_[row] = value.Clone();
+      break;
+  }
+
+  null_bitmap_[row / 64] &= ~(uint64_t{1} << (row % 64));
+  null_count_--;
+}
+
+Value ColumnarTable::Column::GetValue(const size_t row) const {
+  if (IsNull(row))
+    return Value();
+
+  switch (type_) {
+    case ColumnType::kBool:
+      return Value(bools_[row] != 0);
+    case ColumnType::kInt64:
+      return Value(int64s_[row]);
+    case ColumnType::kDouble:
+      return Value(doubles_[row]);
+    case ColumnType::kString:
+      return Value(std::string_view(strings_[row]));
+    case ColumnType::kValue:
+      return values_[row].Clone();
+  }
+
+  RST_NOTREACHED();
+  return Value();
+}
+
+double ColumnarTable::Column::Sum() const {
+  if (type_ == ColumnType::kInt64)
+    return SumOf(int64s_);
+
+  RST_DCHECK(type_ == ColumnType::kDouble);
+  return SumOf(doubles_);
+}
+
+template <class Compare>
+Value ColumnarTable::Column::Extremum(Compare compare) const {
+  const auto find = [this,
+                     &compare](const auto& data) -> std::optional<size_t> {
+    if (null_count_ == size_)
+      return std::nullopt;
+
+    if (null_count_ == 0) {
+      return static_cast<size_t>(
+          std::min_element(data.cbegin(), data.cend(), compare) -
+          data.cbegin());
+    }
+
+    std::optional<size_t> best;
+    for (size_t i = 0; i < size_; i++) {
+      if (IsNull(i))
+        continue;
+      if (!best.has_value() || compare(data[i], data[*best]))
+        best = i;
+    }
+
+    return best;
+  };
+
+  std::optional<size_t> row;
+  switch (type_) {
+    case ColumnType::kInt64:
+      row = find(int64s_);
+      break;
+    case ColumnType::kDouble:
+      row = find(doubles_);
+      break;
+    case ColumnType::kString:
+      row = find(strings_);
+      break;
+    case ColumnType::kBool:
+    case ColumnType::kValue:
+      RST_NOTREACHED();
+      return Value();
+  }
+
+  if (!row.has_value())
+    return Value();
+  return GetValue(*row);
+}
+
+Value ColumnarTable::Column::Min() const { return Extremum(std::less<>()); }
+
+Value ColumnarTable::Column::Max() const {
+  return Extremum(std::greater<>());
+}
+
+ColumnarTable::ColumnarTable() = default;
+
+ColumnarTable::~ColumnarTable() = default;
+
+ColumnarTable::ColumnarTable(ColumnarTable&&) noexcept = default;
+
+ColumnarTable& ColumnarTable::operator=(ColumnarTable&&) noexcept = default;
+
+StatusOr<ColumnarTable> ColumnarTable::FromValue(const Value& array) {
+  RST_DCHECK(array.IsArray());
+  const auto& rows = array.GetArray();
+
+  // The keys of the objects and of the schema are sorted, so they are merged
+  // in a single pass over each row.
+  std::vector<ColumnSchema> schema;
+  for (size_t row = 0; row < rows.size(); row++) {
+    const auto& element = rows[row];
+    if (!element.IsObject())
+      return MakeStatus<ColumnarTableError>("Element is not an object", row);
+
+    size_t column = 0;
+    for (const auto& [key, member] : element.GetObject()) {
+      while (column < schema.size() && schema[column].name < key)
+        column++;
+      if (column == schema.size() || schema[column].name != key)
+        schema.insert(schema.begin() + column, ColumnSchema{key, std::nullopt});
+
+      MergeColumnType(member, &schema[column]);
+      column++;
+    }
+  }
+
+  ColumnarTable table;
+  table.row_count_ = rows.size();
+  table.columns_.reserve(schema.size());
+  for (const auto& column : schema) {
+    table.columns_.emplace_back(Column(
+        column.name, column.type.value_or(ColumnType::kValue), rows.size()));
+  }
+
+  for (size_t row = 0; row < rows.size(); row++) {
+    size_t column = 0;
+    for (const auto& [key, member] : rows[row].GetObject()) {
+      while (table.columns_[column].name() != std::string_view(key))
+        column++;
+      table.columns_[column].Set(row, member);
+      column++;
+    }
+  }
+
+  return table;
+}
+
+Value ColumnarTable::ToValue() const {
+  Value array(Value::Type::kArray);
+  auto& rows = array.GetArray();
+  rows.reserve(row_count_);
+  for (size_t row = 0; row < row_count_; row++) {
+    Value object(Value::Type::kObject);
+    auto& members = object.GetObject();
+    members.reserve(columns_.size());
+    for (const auto& column : columns_) {
+      members.emplace_hint(members.cend(), std::string_view(column.name()),
+                           column.GetValue(row));
+    }
+
+    rows.emplace_back(std::move(object));
+  }
+
+  return array;
+}
+
+Nullable<const ColumnarTable::Column*> ColumnarTable::FindColumn(
+    const std::string_view name) const {
+  const auto it = std::lower_bound(
+      columns_.cbegin(), columns_.cend(), name,
+      [](const Column& column, const std::string_view name) {
+        return column.name() < name;
+      });
+  if (it == columns_.cend() || it->name() != name)
+    return nullptr;
+  return &*it;
+}
+
+}  // namespace rst
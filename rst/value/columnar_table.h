@@ -0,0 +1,254 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_COLUMNAR_TABLE_H_
+#define RST_VALUE_COLUMNAR_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "rst/check/check.h"
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/status/status_or.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Error of converting a `rst::Value` array into `rst::ColumnarTable`.
+class ColumnarTableError final : public ErrorInfo<ColumnarTableError> {
+ public:
+  ColumnarTableError(std::string_view message, size_t index);
+  ~ColumnarTableError() override;
+
+  const std::string& AsString() const override;
+
+  // Index of the array element that caused the error.
+  size_t index() const { return index_; }
+
+  static char id_;
+
+ private:
+  const std::string message_;
+  const size_t index_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ColumnarTableError);
+};
+
+// Struct-of-arrays representation of an array of objects with the same keys.
+// Every key becomes a column that keeps the members of all the rows in a
+// contiguous vector of its type and a bitmap of nulls. The type of a column is
+// inferred from the members: bools, integers, numbers or strings. Integers
+// mixed with other numbers make a column of doubles. Members of other or mixed
+// types are kept as `rst::Value` shallow copies. Missing and null members are
+// nulls.
+//
+// Aggregations run over the contiguous data: nulls of numeric columns are
+// stored as zeros, so sums don't check the bitmap, and the other aggregations
+// check it only if the column has nulls.
+//
+// Example:
+//
+//   #include "rst/value/columnar_table.h"
+//
+//   const rst::Value& orders = ...;  // [{"qty": 1, "price": 2.5}, ...]
+//   rst::StatusOr<rst::ColumnarTable> table =
+//       rst::ColumnarTable::FromValue(orders);
+//   if (table.err())
+//     return std::move(table).TakeStatus();
+//
+//   rst::Nullable<const rst::ColumnarTable::Column*> price =
+//       table->FindColumn("price");
+//   if (price == nullptr)
+//     return ...;
+//   double total = price->Sum();
+//   size_t expensive = price->CountWhere<double>(
+//       [](double price) { return price > 100.0; });
+//   rst::Value back = table->ToValue();
+//
+class ColumnarTable {
+ public:
+  enum class ColumnType {
+    kBool,
+    kInt64,
+    kDouble,
+    kString,
+    kValue,
+  };
+
+  class Column {
+   public:
+    ~Column();
+
+    Column(Column&&) noexcept;
+    Column& operator=(Column&&) noexcept;
+
+    const std::string& name() const { return name_; }
+    ColumnType type() const { return type_; }
+    size_t size() const { return size_; }
+
+    // The bitmap has a bit set for every null row, 64 rows per word.
+    const std::vector<uint64_t>& null_bitmap() const { return null_bitmap_; }
+    size_t null_count() const { return null_count_; }
+    bool IsNull(const size_t row) const {
+      RST_DCHECK(row < size_);
+      return ((null_bitmap_[row / 64] >> (row % 64)) & 1) != 0;
+    }
+
+    // These will all assert that the type matches. Null rows hold zeros,
+    // empty strings and null values.
+    const std::vector<uint8_t>& bools() const {
+      RST_DCHECK(type_ == ColumnType::kBool);
+      return bools_;
+    }
+    const std::vector<int64_t>& int64s() const {
+      RST_DCHECK(type_ == ColumnType::kInt64);
+      return int64s_;
+    }
+    const std::vector<double>& doubles() const {
+      RST_DCHECK(type_ == ColumnType::kDouble);
+      return doubles_;
+    }
+    const std::vector<std::string>& strings() const {
+      RST_DCHECK(type_ == ColumnType::kString);
+      return strings_;
+    }
+    const std::vector<Value>& values() const {
+      RST_DCHECK(type_ == ColumnType::kValue);
+      return values_;
+    }
+
+    // Returns the member of |row| as a value.
+    Value GetValue(size_t row) const;
+
+    // Returns the sum of the numbers. Asserts that the column is numeric.
+    double Sum() const;
+
+    // Return the minimum or the maximum of the numbers or the strings, or null
+    // if all the rows are null. Asserts that the column is of one of these
+    // types.
+    Value Min() const;
+    Value Max() const;
+
+    // Returns the number of non-null rows whose members satisfy |predicate|.
+    // |T| must be `bool`, `int64_t`, `double` or `std::string` matching the
+    // type of the column.
+    template <class T, class Predicate>
+    size_t CountWhere(Predicate&& predicate) const {
+      const auto& data = GetData<T>();
+      size_t count = 0;
+      if (null_count_ == 0) {
+        for (const auto& element : data)
+          count += predicate(static_cast<const T&>(element)) ? 1 : 0;
+        return count;
+      }
+
+      for (size_t i = 0; i < size_; i++) {
+        if (!IsNull(i) && predicate(static_cast<const T&>(data[i])))
+          count++;
+      }
+
+      return count;
+    }
+
+   private:
+    friend class ColumnarTable;
+
+    Column(std::string_view name, ColumnType type, size_t size);
+
+    template <class T>
+    const auto& GetData() const {
+      if constexpr (std::is_same_v<T, bool>) {
+        return bools();
+      } else if constexpr (std::is_same_v<T, int64_t>) {
+        return int64s();
+      } else if constexpr (std::is_same_v<T, double>) {
+        return doubles();
+      } else {
+        static_assert(std::is_same_v<T, std::string>);
+        return strings();
+      }
+    }
+
+    // Stores |value| of the matching type in |row|, or marks it as null.
+    void Set(size_t row, const Value& value);
+
+    template <class Compare>
+    Value Extremum(Compare compare) const;
+
+    std::string name_;
+    ColumnType type_ = ColumnType::kValue;
+    size_t size_ = 0;
+    std::vector<uint64_t> null_bitmap_;
+    size_t null_count_ = 0;
+    std::vector<uint8_t> bools_;
+    std::vector<int64_t> int64s_;
+    std::vector<double> doubles_;
+    std::vector<std::string> strings_;
+    std::vector<Value> values_;
+
+    RST_DISALLOW_COPY_AND_ASSIGN(Column);
+  };
+
+  ~ColumnarTable();
+
+  ColumnarTable(ColumnarTable&&) noexcept;
+  ColumnarTable& operator=(ColumnarTable&&) noexcept;
+
+  // Infers the columns from the members of the objects of |array| and copies
+  // the members into them. Returns `rst::ColumnarTableError` if an element is
+  // not an object. Asserts that |array| is array.
+  static StatusOr<ColumnarTable> FromValue(const Value& array);
+
+  // Converts the table back into an array of objects. Null rows become null
+  // members.
+  Value ToValue() const;
+
+  size_t row_count() const { return row_count_; }
+
+  // The columns sorted by their names.
+  const std::vector<Column>& columns() const { return columns_; }
+
+  Nullable<const Column*> FindColumn(std::string_view name) const;
+
+ private:
+  ColumnarTable();
+
+  size_t row_count_ = 0;
+  std::vector<Column> columns_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ColumnarTable);
+};
+
+}  // namespace rst
+
+#endif  // RST_VALUE_COLUMNAR_TABLE_H_
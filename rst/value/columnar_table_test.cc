@@ -0,0 +1,187 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/columnar_table.h"
+
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/rtti/rtti.h"
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+ColumnarTable FromJsonOrDie(const std::string_view json) {
+  auto table = ColumnarTable::FromValue(ParseJsonOrDie(json));
+  RST_CHECK(!table.err());
+  return std::move(*table);
+}
+
+}  // namespace
+
+TEST(ColumnarTable, Schema) {
+  const auto table = FromJsonOrDie(R"([
+    {"b": true, "d": 1.5, "i": 1, "n": null, "s": "a", "v": [1]},
+    {"b": false, "d": 2, "i": 2, "s": "b", "v": "x", "x": 1},
+    {"d": null, "i": -3, "n": null, "s": "", "v": {"a": 1}}
+  ])");
+
+  EXPECT_EQ(table.row_count(), 3U);
+  const auto& columns = table.columns();
+  ASSERT_EQ(columns.size(), 7U);
+
+  EXPECT_EQ(columns[0].name(), "b");
+  EXPECT_EQ(columns[0].type(), ColumnarTable::ColumnType::kBool);
+  EXPECT_EQ(columns[0].null_count(), 1U);
+  EXPECT_FALSE(columns[0].IsNull(0));
+  EXPECT_TRUE(columns[0].IsNull(2));
+  EXPECT_EQ(columns[0].bools(), (std::vector<uint8_t>{1, 0, 0}));
+
+  EXPECT_EQ(columns[1].name(), "d");
+  EXPECT_EQ(columns[1].type(), ColumnarTable::ColumnType::kDouble);
+  EXPECT_EQ(columns[1].doubles(), (std::vector<double>{1.5, 2.0, 0.0}));
+
+  EXPECT_EQ(columns[2].name(), "i");
+  EXPECT_EQ(columns[2].type(), ColumnarTable::ColumnType::kInt64);
+  EXPECT_EQ(columns[2].null_count(), 0U);
+  EXPECT_EQ(columns[2].int64s(), (std::vector<int64_t>{1, 2, -3}));
+
+  EXPECT_EQ(columns[3].name(), "n");
+  EXPECT_EQ(columns[3].type(), ColumnarTable::ColumnType::kValue);
+  EXPECT_EQ(columns[3].null_count(), 3U);
+
+  EXPECT_EQ(columns[4].name(), "s");
+  EXPECT_EQ(columns[4].type(), ColumnarTable::ColumnType::kString);
+  EXPECT_EQ(columns[4].strings(), (std::vector<std::string>{"a", "b", ""}));
+  EXPECT_EQ(columns[4].null_bitmap(), std::vector<uint64_t>{~uint64_t{7}});
+
+  EXPECT_EQ(columns[5].name(), "v");
+  EXPECT_EQ(columns[5].type(), ColumnarTable::ColumnType::kValue);
+  EXPECT_EQ(columns[5].GetValue(2), ParseJsonOrDie(R"({"a": 1})"));
+
+  EXPECT_EQ(columns[6].name(), "x");
+  EXPECT_EQ(columns[6].type(), ColumnarTable::ColumnType::kInt64);
+  EXPECT_EQ(columns[6].null_count(), 2U);
+  EXPECT_TRUE(columns[6].IsNull(0));
+  EXPECT_FALSE(columns[6].IsNull(1));
+
+  const auto column = table.FindColumn("s");
+  ASSERT_NE(column, nullptr);
+  EXPECT_EQ(column->name(), "s");
+  EXPECT_EQ(table.FindColumn("c"), nullptr);
+  EXPECT_EQ(table.FindColumn("z"), nullptr);
+}
+
+TEST(ColumnarTable, ToValue) {
+  const auto value = ParseJsonOrDie(R"([
+    {"a": 1, "b": "x", "c": [1, {"d": null}]},
+    {"a": 2.5, "b": "y", "c": false},
+    {"a": null, "b": null, "c": null}
+  ])");
+  auto table = ColumnarTable::FromValue(value);
+  ASSERT_FALSE(table.err());
+  EXPECT_EQ(table->ToValue(), value);
+
+  const auto empty = FromJsonOrDie("[]");
+  EXPECT_EQ(empty.row_count(), 0U);
+  EXPECT_TRUE(empty.columns().empty());
+  EXPECT_EQ(empty.ToValue(), Value(Value::Type::kArray));
+
+  EXPECT_EQ(FromJsonOrDie(R"([{"a": 1}, {}])").ToValue(),
+            ParseJsonOrDie(R"([{"a": 1}, {"a": null}])"));
+}
+
+TEST(ColumnarTable, Aggregations) {
+  Value value(Value::Type::kArray);
+  for (auto i = 0; i < 1000; i++) {
+    Value row(Value::Type::kObject);
+    row.SetKey("id", Value(i));
+    row.SetKey("price", Value(i * 0.5));
+    if (i % 10 != 0)
+      row.SetKey("qty", Value(i % 7));
+    row.SetKey("sku", Value(std::to_string(i)));
+    value.GetArray().emplace_back(std::move(row));
+  }
+
+  auto table = ColumnarTable::FromValue(value);
+  ASSERT_FALSE(table.err());
+
+  const auto id = table->FindColumn("id");
+  ASSERT_NE(id, nullptr);
+  EXPECT_EQ(id->Sum(), 499500.0);
+  EXPECT_EQ(id->Min(), Value(0));
+  EXPECT_EQ(id->Max(), Value(999));
+  EXPECT_EQ(id->CountWhere<int64_t>([](const int64_t id) { return id >= 900; }),
+            100U);
+
+  const auto price = table->FindColumn("price");
+  ASSERT_NE(price, nullptr);
+  EXPECT_EQ(price->type(), ColumnarTable::ColumnType::kDouble);
+  EXPECT_EQ(price->Sum(), 249750.0);
+  EXPECT_EQ(price->Max(), Value(499.5));
+
+  const auto qty = table->FindColumn("qty");
+  ASSERT_NE(qty, nullptr);
+  EXPECT_EQ(qty->null_count(), 100U);
+  EXPECT_EQ(qty->Min(), Value(0));
+  EXPECT_EQ(qty->Max(), Value(6));
+  EXPECT_EQ(
+      qty->CountWhere<int64_t>([](const int64_t qty) { return qty == 0; }),
+      128U);
+
+  const auto sku = table->FindColumn("sku");
+  ASSERT_NE(sku, nullptr);
+  EXPECT_EQ(sku->Min(), Value("0"));
+  EXPECT_EQ(sku->Max(), Value("999"));
+  EXPECT_EQ(sku->CountWhere<std::string>(
+                [](const std::string& sku) { return sku.size() == 2; }),
+            90U);
+
+  const auto flags = FromJsonOrDie(R"([{"a": true}, {"a": null}, {"a": 1}])");
+  EXPECT_EQ(flags.columns()[0].type(), ColumnarTable::ColumnType::kValue);
+  const auto bools = FromJsonOrDie(R"([{"a": true}, {"a": null}, {}])");
+  EXPECT_EQ(bools.columns()[0].CountWhere<bool>([](const bool a) { return a; }),
+            1U);
+
+  const auto nulls = FromJsonOrDie(R"([{"a": null}, {"a": 2}, {"a": 1}])");
+  EXPECT_EQ(nulls.columns()[0].Min(), Value(1));
+  EXPECT_EQ(FromJsonOrDie(R"([{"a": null}, {"a": 1.5}])").columns()[0].Max(),
+            Value(1.5));
+}
+
+TEST(ColumnarTable, Errors) {
+  auto table = ColumnarTable::FromValue(ParseJsonOrDie(R"([{"a": 1}, 2])"));
+  ASSERT_TRUE(table.err());
+  const auto error = dyn_cast<ColumnarTableError>(table.status().GetError());
+  ASSERT_NE(error, nullptr);
+  EXPECT_EQ(error->index(), 1U);
+}
+
+}  // namespace rst
@@ -0,0 +1,328 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_binding.h"
+
+#include <cmath>
+
+#include "rst/check/check.h"
+#include "rst/macros/optimization.h"
+#include "rst/value/json_scanner.h"
+
+namespace rst {
+namespace internal {
+namespace {
+
+constexpr bool IsWhitespace(const char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+constexpr bool IsNumberStart(const char c) {
+  return c == '-' || (c >= '0' && c <= '9');
+}
+
+}  // namespace
+
+JsonDecoder::JsonDecoder(const std::string_view json,
+                         const JsonMaxDepth max_depth)
+    : json_(json), max_depth_(max_depth.value()) {}
+
+JsonDecoder::~JsonDecoder() {
+  if (error_.has_value())
+    error_->Ignore();
+}
+
+bool JsonDecoder::ConsumeNull(const NotNull<bool*> is_null) {
+  SkipWhitespace();
+  *is_null = false;
+  if (offset_ == json_.size() || json_[offset_] != 'n')
+    return true;
+
+  Value value;
+  if (!ReadScalar(&value))
+    return false;
+  *is_null = value.IsNull();
+  RST_DCHECK(*is_null);
+  return true;
+}
+
+bool JsonDecoder::ReadBool(const NotNull<bool*> value) {
+  SkipWhitespace();
+  if (offset_ == json_.size() ||
+      (json_[offset_] != 't' && json_[offset_] != 'f')) {
+    return Fail("Expected bool");
+  }
+
+  Value scalar;
+  if (!ReadScalar(&scalar))
+    return false;
+  *value = scalar.GetBool();
+  return true;
+}
+
+bool JsonDecoder::ReadInt64(const NotNull<int64_t*> value, const int64_t min,
+                            const int64_t max) {
+  SkipWhitespace();
+  const auto number_offset = offset_;
+  if (offset_ == json_.size() || !IsNumberStart(json_[offset_]))
+    return Fail("Expected number");
+
+  Value scalar;
+  if (!ReadScalar(&scalar))
+    return false;
+
+  if (!scalar.IsInt64()) {
+    offset_ = number_offset;
+    return Fail("Expected integer");
+  }
+
+  const auto number = scalar.GetInt64();
+  if (number < min || number > max) {
+    offset_ = number_offset;
+    return Fail("Number out of range");
+  }
+
+  *value = number;
+  return true;
+}
+
+bool JsonDecoder::ReadDouble(const NotNull<double*> value, const double max) {
+  SkipWhitespace();
+  const auto number_offset = offset_;
+  if (offset_ == json_.size() || !IsNumberStart(json_[offset_]))
+    return Fail("Expected number");
+
+  Value scalar;
+  if (!ReadScalar(&scalar))
+    return false;
+
+  const auto number = scalar.GetDouble();
+  if (std::fabs(number) > max) {
+    offset_ = number_offset;
+    return Fail("Number out of range");
+  }
+
+  *value = number;
+  return true;
+}
+
+bool JsonDecoder::ReadString(const NotNull<std::string*> value) {
+  SkipWhitespace();
+  if (offset_ == json_.size() || json_[offset_] != '"')
+    return Fail("Expected string");
+
+  offset_++;
+  value->clear();
+  return ReadStringContents(value);
+}
+
+bool JsonDecoder::ReadValue(const NotNull<Value*> value) {
+  SkipWhitespace();
+  if (depth_ >= max_depth_)
+    return Fail("Too deep nesting");
+
+  size_t end = 0;
+  auto status = ParseJsonValue(json_, offset_, 0,
+                               JsonMaxDepth(max_depth_ - depth_), value, &end);
+  if (status.err()) {
+    error_ = std::move(status);
+    return false;
+  }
+
+  offset_ = end;
+  return true;
+}
+
+bool JsonDecoder::SkipValue() {
+  // Unknown values are validated by parsing them. Scalars are not allocated.
+  Value value;
+  return ReadValue(&value);
+}
+
+bool JsonDecoder::StartObject() { return StartContainer('{'); }
+
+bool JsonDecoder::NextKey(const NotNull<bool*> has_key,
+                          const NotNull<std::string_view*> key) {
+  SkipWhitespace();
+  if (RST_UNLIKELY(offset_ == json_.size()))
+    return Fail("Unexpected end of input");
+
+  if (json_[offset_] == '}') {
+    offset_++;
+    depth_--;
+    is_first_ = false;
+    *has_key = false;
+    return true;
+  }
+
+  if (!is_first_) {
+    if (json_[offset_] != ',')
+      return Fail("Expected ',' or '}'");
+    offset_++;
+    SkipWhitespace();
+  }
+  is_first_ = false;
+
+  if (offset_ == json_.size() || json_[offset_] != '"')
+    return Fail("Expected string key");
+  offset_++;
+
+  // Keys without escape sequences are returned as views into the input.
+  const auto begin = json_.data() + offset_;
+  const auto end = json_.data() + json_.size();
+  const auto special = FindJsonStringSpecialChar(begin, end);
+  if (special != end && *special == '"') {
+    *key = std::string_view(begin, static_cast<size_t>(special - begin));
+    offset_ += key->size() + 1;
+  } else {
+    key_buffer_.clear();
+    if (!ReadStringContents(&key_buffer_))
+      return false;
+    *key = key_buffer_;
+  }
+
+  SkipWhitespace();
+  if (offset_ == json_.size() || json_[offset_] != ':')
+    return Fail("Expected ':'");
+  offset_++;
+
+  *has_key = true;
+  return true;
+}
+
+bool JsonDecoder::StartArray() { return StartContainer('['); }
+
+bool JsonDecoder::NextElement(const NotNull<bool*> has_element) {
+  SkipWhitespace();
+  if (RST_UNLIKELY(offset_ == json_.size()))
+    return Fail("Unexpected end of input");
+
+  if (json_[offset_] == ']') {
+    offset_++;
+    depth_--;
+    is_first_ = false;
+    *has_element = false;
+    return true;
+  }
+
+  if (!is_first_) {
+    if (json_[offset_] != ',')
+      return Fail("Expected ',' or ']'");
+    offset_++;
+  }
+  is_first_ = false;
+
+  *has_element = true;
+  return true;
+}
+
+bool JsonDecoder::Finish() {
+  SkipWhitespace();
+  if (offset_ != json_.size())
+    return Fail("Unexpected data after root value");
+  return true;
+}
+
+Status JsonDecoder::TakeError() {
+  if (error_.has_value()) {
+    auto error = std::move(*error_);
+    error_.reset();
+    return error;
+  }
+
+  return MakeStatus<JsonParseError>(error_message_, offset_);
+}
+
+bool JsonDecoder::Fail(const std::string_view message) {
+  error_message_ = message;
+  return false;
+}
+
+void JsonDecoder::SkipWhitespace() {
+  while (offset_ != json_.size() && IsWhitespace(json_[offset_]))
+    offset_++;
+}
+
+bool JsonDecoder::ReadScalar(const NotNull<Value*> value) {
+  size_t end = 0;
+  auto status =
+      ParseJsonValue(json_, offset_, 0, JsonMaxDepth(1), value, &end);
+  if (status.err()) {
+    error_ = std::move(status);
+    return false;
+  }
+
+  offset_ = end;
+  return true;
+}
+
+bool JsonDecoder::StartContainer(const char begin) {
+  SkipWhitespace();
+  if (offset_ == json_.size() || json_[offset_] != begin)
+    return Fail(begin == '{' ? "Expected object" : "Expected array");
+  if (depth_ == max_depth_)
+    return Fail("Too deep nesting");
+
+  offset_++;
+  depth_++;
+  is_first_ = true;
+  return true;
+}
+
+bool JsonDecoder::ReadStringContents(const NotNull<std::string*> value) {
+  auto current = json_.data() + offset_;
+  const auto end = json_.data() + json_.size();
+  auto chunk_begin = current;
+  while (true) {
+    current = FindJsonStringSpecialChar(current, end);
+    offset_ = static_cast<size_t>(current - json_.data());
+    if (RST_UNLIKELY(current == end))
+      return Fail("Unterminated string");
+
+    if (*current == '"') {
+      value->append(chunk_begin, current);
+      offset_++;
+      return true;
+    }
+
+    if (*current != '\\')
+      return Fail("Control character in string");
+
+    value->append(chunk_begin, current);
+    current++;  // '\\'.
+    std::string_view error_message;
+    if (!DecodeJsonEscape<std::string>(&current, end, value, &error_message)) {
+      offset_ = static_cast<size_t>(current - json_.data());
+      return Fail(error_message);
+    }
+
+    chunk_begin = current;
+  }
+}
+
+}  // namespace internal
+}  // namespace rst
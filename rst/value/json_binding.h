@@ -0,0 +1,469 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_JSON_BINDING_H_
+#define RST_VALUE_JSON_BINDING_H_
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rst/check/check.h"
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/value/json_reader.h"
+#include "rst/value/json_writer.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Binds the member |member| of |T| to the JSON key |name|.
+template <class T, class M>
+class JsonField {
+ public:
+  constexpr JsonField(const std::string_view name, M T::*const member)
+      : name_(name), member_(member) {}
+
+  constexpr std::string_view name() const { return name_; }
+  constexpr M T::*member() const { return member_; }
+
+ private:
+  std::string_view name_;
+  M T::*member_;
+};
+
+// Specialize for a struct with a `kFields` tuple of `rst::JsonField` to decode
+// and encode it with `rst::DecodeJson()` and `rst::EncodeJson()`.
+template <class T>
+struct JsonFields {};
+
+namespace internal {
+
+// Reads JSON tokens directly into C++ values. Functions return false on error
+// and store the error message and position.
+class JsonDecoder {
+ public:
+  JsonDecoder(std::string_view json, JsonMaxDepth max_depth);
+  ~JsonDecoder();
+
+  // Skips null and sets |is_null| if it's the next token.
+  bool ConsumeNull(NotNull<bool*> is_null);
+
+  bool ReadBool(NotNull<bool*> value);
+  bool ReadInt64(NotNull<int64_t*> value, int64_t min, int64_t max);
+  // Fails if the magnitude of the number exceeds |max|.
+  bool ReadDouble(NotNull<double*> value, double max);
+  bool ReadString(NotNull<std::string*> value);
+  bool ReadValue(NotNull<Value*> value);
+  // Skips a value of an unknown key.
+  bool SkipValue();
+
+  // Iterates over the members of an object. Call StartObject() and then
+  // NextKey() before every value until |has_key| is false.
+  bool StartObject();
+  bool NextKey(NotNull<bool*> has_key, NotNull<std::string_view*> key);
+
+  // Iterates over the elements of an array. Call StartArray() and then
+  // NextElement() before every element until |has_element| is false.
+  bool StartArray();
+  bool NextElement(NotNull<bool*> has_element);
+
+  // Checks that there is only whitespace after the decoded value.
+  bool Finish();
+
+  // Returns the error after one of the functions has returned false.
+  Status TakeError();
+
+ private:
+  bool Fail(std::string_view message);
+  void SkipWhitespace();
+  // Reads a null, a bool or a number with the `rst::Value` parser.
+  bool ReadScalar(NotNull<Value*> value);
+  bool StartContainer(char begin);
+  // Reads the rest of a string after the opening quote.
+  bool ReadStringContents(NotNull<std::string*> value);
+
+  const std::string_view json_;
+  const size_t max_depth_;
+  size_t offset_ = 0;
+  size_t depth_ = 0;
+  // Whether the next NextKey() or NextElement() is the first one of the
+  // current container.
+  bool is_first_ = false;
+  // Keys with escape sequences are decoded here.
+  std::string key_buffer_;
+  std::string_view error_message_;
+  // The error of the `rst::Value` parser, if any.
+  std::optional<Status> error_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonDecoder);
+};
+
+template <class T, class = void>
+struct HasJsonFields : std::false_type {};
+
+template <class T>
+struct HasJsonFields<T, std::void_t<decltype(JsonFields<T>::kFields)>>
+    : std::true_type {};
+
+// Decodes and encodes values of type |T|. The specialization is chosen at
+// compile time.
+template <class T, class = void>
+struct JsonCodec {
+  static_assert(HasJsonFields<T>::value,
+                "Specialize rst::JsonFields<T> to bind the struct to JSON");
+
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<T*> object) {
+    if (!decoder->StartObject())
+      return false;
+
+    while (true) {
+      auto has_key = false;
+      std::string_view key;
+      if (!decoder->NextKey(&has_key, &key))
+        return false;
+      if (!has_key)
+        return true;
+
+      auto is_found = false;
+      auto is_decoded = false;
+      std::apply(
+          [&](const auto&... fields) {
+            ((is_found = is_found || DecodeField(key, fields, decoder, object,
+                                                 &is_decoded)),
+             ...);
+          },
+          JsonFields<T>::kFields);
+
+      if (is_found && !is_decoded)
+        return false;
+      if (!is_found && !decoder->SkipValue())
+        return false;
+    }
+  }
+
+  static void Encode(const T& object, const NotNull<std::string*> out) {
+    *out += '{';
+    auto is_first = true;
+    std::apply(
+        [&](const auto&... fields) {
+          (EncodeField(object, fields, out, &is_first), ...);
+        },
+        JsonFields<T>::kFields);
+    *out += '}';
+  }
+
+ private:
+  // Decodes the member of |field| if its name is |key|. Returns true if the
+  // name matches.
+  template <class M>
+  static bool DecodeField(const std::string_view key,
+                          const JsonField<T, M>& field,
+                          const NotNull<JsonDecoder*> decoder,
+                          const NotNull<T*> object,
+                          const NotNull<bool*> is_decoded) {
+    if (key != field.name())
+      return false;
+
+    *is_decoded =
+        JsonCodec<M>::Decode(decoder, &(object.get()->*field.member()));
+    return true;
+  }
+
+  template <class M>
+  static void EncodeField(const T& object, const JsonField<T, M>& field,
+                          const NotNull<std::string*> out,
+                          const NotNull<bool*> is_first) {
+    if (!*is_first)
+      *out += ',';
+    *is_first = false;
+
+    WriteJsonString(field.name(), out);
+    *out += ':';
+    JsonCodec<M>::Encode(object.*field.member(), out);
+  }
+};
+
+template <>
+struct JsonCodec<bool> {
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<bool*> value) {
+    return decoder->ReadBool(value);
+  }
+
+  static void Encode(const bool value, const NotNull<std::string*> out) {
+    *out += value ? std::string_view("true") : std::string_view("false");
+  }
+};
+
+template <class T>
+struct JsonCodec<T, std::enable_if_t<std::is_integral_v<T> &&
+                                     !std::is_same_v<T, bool>>> {
+  static_assert(sizeof(T) <= sizeof(int64_t));
+
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<T*> value) {
+    // Values only represent integers up to 2^53 - 1 exactly.
+    constexpr int64_t kMaxSafeInteger =
+        (int64_t{1} << std::numeric_limits<double>::digits) - 1;
+    constexpr auto kMin =
+        std::is_signed_v<T>
+            ? std::max<int64_t>(std::numeric_limits<T>::min(), -kMaxSafeInteger)
+            : int64_t{0};
+    constexpr auto kMax =
+        static_cast<uint64_t>(std::numeric_limits<T>::max()) >
+                static_cast<uint64_t>(kMaxSafeInteger)
+            ? kMaxSafeInteger
+            : static_cast<int64_t>(std::numeric_limits<T>::max());
+
+    int64_t number = 0;
+    if (!decoder->ReadInt64(&number, kMin, kMax))
+      return false;
+    *value = static_cast<T>(number);
+    return true;
+  }
+
+  static void Encode(const T value, const NotNull<std::string*> out) {
+    // Enough for -2^63 and 2^64 - 1.
+    char buffer[24];
+    const auto [ptr, ec] =
+        std::to_chars(buffer, buffer + sizeof(buffer), value);
+    RST_DCHECK(ec == std::errc());
+    out->append(buffer, ptr);
+  }
+};
+
+template <class T>
+struct JsonCodec<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<T*> value) {
+    // Narrowing a double outside the range of |T| is undefined behavior.
+    // Numbers that round to the largest |T|, like 3.4028235e+38 written for
+    // the largest float, are clamped to it.
+    constexpr auto kMax = std::numeric_limits<T>::max();
+    auto limit = std::numeric_limits<double>::max();
+    if constexpr (std::numeric_limits<T>::max_exponent <
+                  std::numeric_limits<double>::max_exponent) {
+      const auto half_ulp =
+          std::ldexp(1.0, std::numeric_limits<T>::max_exponent -
+                              std::numeric_limits<T>::digits - 1);
+      limit = std::nextafter(static_cast<double>(kMax) + half_ulp, 0.0);
+    }
+
+    double number = 0.0;
+    if (!decoder->ReadDouble(&number, limit))
+      return false;
+    if (std::fabs(number) > static_cast<double>(kMax))
+      *value = number > 0.0 ? kMax : -kMax;
+    else
+      *value = static_cast<T>(number);
+    return true;
+  }
+
+  static void Encode(const T value, const NotNull<std::string*> out) {
+    RST_DCHECK(std::isfinite(value) &&
+               "Non-finite (i.e. NaN or positive/negative infinity) values "
+               "cannot be represented in JSON");
+    if constexpr (std::is_same_v<T, float>)
+      WriteJsonNumber(value, out);
+    else
+      WriteJsonNumber(static_cast<double>(value), out);
+  }
+};
+
+template <>
+struct JsonCodec<std::string> {
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<std::string*> value) {
+    return decoder->ReadString(value);
+  }
+
+  static void Encode(const std::string& value,
+                     const NotNull<std::string*> out) {
+    WriteJsonString(value, out);
+  }
+};
+
+template <class T>
+struct JsonCodec<std::optional<T>> {
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<std::optional<T>*> value) {
+    auto is_null = false;
+    if (!decoder->ConsumeNull(&is_null))
+      return false;
+    if (is_null) {
+      value->reset();
+      return true;
+    }
+
+    if (!value->has_value())
+      value->emplace();
+    return JsonCodec<T>::Decode(decoder, &**value);
+  }
+
+  static void Encode(const std::optional<T>& value,
+                     const NotNull<std::string*> out) {
+    if (!value.has_value()) {
+      *out += "null";
+      return;
+    }
+
+    JsonCodec<T>::Encode(*value, out);
+  }
+};
+
+template <class T>
+struct JsonCodec<std::vector<T>> {
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<std::vector<T>*> value) {
+    value->clear();
+    if (!decoder->StartArray())
+      return false;
+
+    while (true) {
+      auto has_element = false;
+      if (!decoder->NextElement(&has_element))
+        return false;
+      if (!has_element)
+        return true;
+
+      if (!JsonCodec<T>::Decode(decoder, &value->emplace_back()))
+        return false;
+    }
+  }
+
+  static void Encode(const std::vector<T>& value,
+                     const NotNull<std::string*> out) {
+    *out += '[';
+    auto is_first = true;
+    for (const auto& element : value) {
+      if (!is_first)
+        *out += ',';
+      is_first = false;
+      JsonCodec<T>::Encode(element, out);
+    }
+    *out += ']';
+  }
+};
+
+template <>
+struct JsonCodec<Value> {
+  static bool Decode(const NotNull<JsonDecoder*> decoder,
+                     const NotNull<Value*> value) {
+    return decoder->ReadValue(value);
+  }
+
+  static void Encode(const Value& value, const NotNull<std::string*> out) {
+    WriteJson(value, out);
+  }
+};
+
+}  // namespace internal
+
+// Decodes |json| straight into |object| without building a `rst::Value`
+// tree. |T| is a bool, an integer, a floating point number, `std::string`,
+// `std::optional<>`, `std::vector<>`, `rst::Value` or a struct bound with
+// `rst::JsonFields`. The decoding of every field is chosen at compile time.
+// Struct members whose keys are missing keep their values, unknown keys are
+// skipped, null is only accepted by `std::optional<>` and `rst::Value`
+// members. Integers must be exact and fit both the member type and the range
+// of `rst::Value` integers, ±(2^53 - 1). Returns `rst::JsonParseError` with
+// the offset of the error if |json| is malformed or doesn't match |T|, in
+// which case |object| is partially decoded.
+//
+// Example:
+//
+//   #include "rst/value/json_binding.h"
+//
+//   struct Point {
+//     int x = 0;
+//     int y = 0;
+//     std::optional<std::string> label;
+//   };
+//
+//   template <>
+//   struct rst::JsonFields<Point> {
+//     static constexpr auto kFields = std::make_tuple(
+//         rst::JsonField("x", &Point::x), rst::JsonField("y", &Point::y),
+//         rst::JsonField("label", &Point::label));
+//   };
+//
+//   Point point;
+//   rst::Status status = rst::DecodeJson(R"({"x": 1, "y": 2})", &point);
+//
+template <class T>
+Status DecodeJson(const std::string_view json, const NotNull<T*> object,
+                  const JsonMaxDepth max_depth = JsonMaxDepth(200)) {
+  internal::JsonDecoder decoder(json, max_depth);
+  if (!internal::JsonCodec<T>::Decode(&decoder, object) ||
+      !decoder.Finish()) {
+    return decoder.TakeError();
+  }
+
+  return Status::OK();
+}
+
+template <class T>
+Status DecodeJson(const std::string_view json, T* const object,
+                  const JsonMaxDepth max_depth = JsonMaxDepth(200)) {
+  return DecodeJson(json, NotNull(object), max_depth);
+}
+
+// Appends the JSON representation of |object| to |out| like `rst::WriteJson()`
+// does, without building a `rst::Value` tree. Struct members are written in
+// the order of their fields. Integers beyond ±(2^53 - 1) are written exactly
+// but can't be decoded back.
+//
+// Example:
+//
+//   #include "rst/value/json_binding.h"
+//
+//   const Point point = ...;
+//   std::string json;
+//   rst::EncodeJson(point, &json);
+//
+template <class T>
+void EncodeJson(const T& object, const NotNull<std::string*> out) {
+  internal::JsonCodec<T>::Encode(object, out);
+}
+
+}  // namespace rst
+
+#endif  // RST_VALUE_JSON_BINDING_H_
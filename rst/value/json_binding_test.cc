@@ -0,0 +1,210 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_binding.h"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rst/not_null/not_null.h"
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+struct Point {
+  int x = 0;
+  int y = 0;
+};
+
+struct Shape {
+  std::string name;
+  std::vector<Point> points;
+  std::optional<double> area;
+  bool closed = false;
+  uint8_t layer = 0;
+  int64_t id = 0;
+  Value extra;
+};
+
+}  // namespace
+
+template <>
+struct JsonFields<Point> {
+  static constexpr auto kFields =
+      std::make_tuple(JsonField("x", &Point::x), JsonField("y", &Point::y));
+};
+
+template <>
+struct JsonFields<Shape> {
+  static constexpr auto kFields = std::make_tuple(
+      JsonField("name", &Shape::name), JsonField("points", &Shape::points),
+      JsonField("area", &Shape::area), JsonField("closed", &Shape::closed),
+      JsonField("layer", &Shape::layer), JsonField("id", &Shape::id),
+      JsonField("extra", &Shape::extra));
+};
+
+namespace {
+
+template <class T>
+T Decode(const std::string_view json) {
+  T object;
+  auto status = DecodeJson(json, &object);
+  RST_CHECK(!status.err());
+  return object;
+}
+
+template <class T>
+std::string Encode(const T& object) {
+  std::string json;
+  EncodeJson(object, &json);
+  return json;
+}
+
+template <class T>
+size_t ErrorOffset(const std::string_view json,
+                   const JsonMaxDepth max_depth = JsonMaxDepth(200)) {
+  T object;
+  return GetErrorOffset<JsonParseError>(DecodeJson(json, &object, max_depth));
+}
+
+}  // namespace
+
+TEST(JsonBinding, Scalars) {
+  EXPECT_TRUE(Decode<bool>(" true "));
+  EXPECT_EQ(Decode<int>("-12"), -12);
+  EXPECT_EQ(Decode<uint16_t>("65535"), 65535);
+  EXPECT_EQ(Decode<int64_t>("9007199254740991"), 9007199254740991);
+  EXPECT_EQ(Decode<double>("1.5e2"), 150.0);
+  EXPECT_EQ(Decode<float>("2"), 2.0f);
+  EXPECT_EQ(Decode<float>("3.4028235e38"), std::numeric_limits<float>::max());
+  EXPECT_EQ(Decode<float>("-3.4028235e38"),
+            std::numeric_limits<float>::lowest());
+  EXPECT_EQ(Decode<std::string>(R"("a\"bé")"), "a\"b\xc3\xa9");
+  EXPECT_EQ(Decode<std::optional<int>>("null"), std::nullopt);
+  EXPECT_EQ(Decode<std::optional<int>>("1"), 1);
+  EXPECT_EQ(Decode<std::vector<int>>("[1, 2, 3]"), std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(Decode<std::vector<int>>("[]"), std::vector<int>());
+
+  EXPECT_EQ(Encode(true), "true");
+  EXPECT_EQ(Encode(-12), "-12");
+  EXPECT_EQ(Encode(uint64_t{18446744073709551615U}), "18446744073709551615");
+  EXPECT_EQ(Encode(0.1), "0.1");
+  EXPECT_EQ(Encode(0.1f), "0.1");
+  EXPECT_EQ(Encode(3.4028235e38f), "3.4028235e+38");
+  EXPECT_DEATH(Encode(std::numeric_limits<double>::quiet_NaN()), "");
+  EXPECT_DEATH(Encode(std::numeric_limits<float>::infinity()), "");
+  EXPECT_EQ(Encode(std::string("a\"\n")), R"("a\"\n")");
+  EXPECT_EQ(Encode(std::optional<int>()), "null");
+  EXPECT_EQ(Encode(std::vector<int>({1, 2})), "[1,2]");
+}
+
+TEST(JsonBinding, Structs) {
+  const auto shape = Decode<Shape>(R"({
+    "name": "triangle",
+    "unknown": {"a": [1, {"b": null}]},
+    "points": [{"x": 1, "y": 2}, {"y": 4, "x": 3}, {}],
+    "area": 0.5,
+    "closed": true,
+    "layer": 7,
+    "extra": {"key": "value"},
+    "id": -1
+  })");
+  EXPECT_EQ(shape.name, "triangle");
+  ASSERT_EQ(shape.points.size(), 3U);
+  EXPECT_EQ(shape.points[0].x, 1);
+  EXPECT_EQ(shape.points[0].y, 2);
+  EXPECT_EQ(shape.points[1].x, 3);
+  EXPECT_EQ(shape.points[1].y, 4);
+  EXPECT_EQ(shape.points[2].x, 0);
+  EXPECT_EQ(shape.area, 0.5);
+  EXPECT_TRUE(shape.closed);
+  EXPECT_EQ(shape.layer, 7);
+  EXPECT_EQ(shape.id, -1);
+  ASSERT_TRUE(shape.extra.IsObject());
+  const auto extra = shape.extra.FindStringKey("key");
+  ASSERT_NE(extra, nullptr);
+  EXPECT_EQ(*extra, "value");
+
+  EXPECT_EQ(Encode(shape),
+            R"({"name":"triangle","points":[{"x":1,"y":2},{"x":3,"y":4},)"
+            R"({"x":0,"y":0}],"area":0.5,"closed":true,"layer":7,"id":-1,)"
+            R"("extra":{"key":"value"}})");
+
+  const auto decoded = Decode<Shape>(Encode(shape));
+  EXPECT_EQ(Encode(decoded), Encode(shape));
+
+  const auto escaped_key = Decode<Point>(R"({"\u0078": 5})");
+  EXPECT_EQ(escaped_key.x, 5);
+}
+
+TEST(JsonBinding, DecodeToNotNull) {
+  int value = 0;
+  const NotNull<int*> object(&value);
+  auto status = DecodeJson("1", object);
+  ASSERT_FALSE(status.err());
+  EXPECT_EQ(value, 1);
+
+  int* const null_object = nullptr;
+  EXPECT_DEATH((void)DecodeJson("1", null_object).err(), "");
+}
+
+TEST(JsonBinding, Errors) {
+  EXPECT_EQ(ErrorOffset<int>("1.5"), 0U);
+  EXPECT_EQ(ErrorOffset<int>("true"), 0U);
+  EXPECT_EQ(ErrorOffset<uint8_t>("256"), 0U);
+  EXPECT_EQ(ErrorOffset<uint8_t>("-1"), 0U);
+  EXPECT_EQ(ErrorOffset<int64_t>("9007199254740992"), 0U);
+  EXPECT_EQ(ErrorOffset<float>("1e39"), 0U);
+  EXPECT_EQ(ErrorOffset<float>("3.4028236e38"), 0U);
+  EXPECT_EQ(ErrorOffset<float>(" -1e300"), 1U);
+  EXPECT_EQ(ErrorOffset<std::vector<float>>("[1, 1e39]"), 4U);
+  EXPECT_EQ(ErrorOffset<bool>("null"), 0U);
+  EXPECT_EQ(ErrorOffset<bool>("tru"), 0U);
+  EXPECT_EQ(ErrorOffset<std::string>(R"("a)"), 2U);
+  EXPECT_EQ(ErrorOffset<std::vector<int>>("[1,]"), 3U);
+  EXPECT_EQ(ErrorOffset<std::vector<int>>("[1 2]"), 3U);
+  EXPECT_EQ(ErrorOffset<Point>(R"({"x": 1,})"), 8U);
+  EXPECT_EQ(ErrorOffset<Point>(R"({"x" 1})"), 5U);
+  EXPECT_EQ(ErrorOffset<Point>(R"({"x": "1"})"), 6U);
+  EXPECT_EQ(ErrorOffset<Point>(R"({"z": [}, "x": 1})"), 7U);
+  EXPECT_EQ(ErrorOffset<Point>(R"({"x": 1} 1)"), 9U);
+  EXPECT_EQ(ErrorOffset<Point>("[]"), 0U);
+  EXPECT_EQ(ErrorOffset<std::vector<std::vector<int>>>("[[1]]",
+                                                       JsonMaxDepth(1)),
+            1U);
+  EXPECT_EQ(ErrorOffset<Point>(R"({"z": [[1]]})", JsonMaxDepth(2)), 7U);
+}
+
+}  // namespace rst
@@ -0,0 +1,361 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_cursor.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/status/status_macros.h"
+#include "rst/value/json_scanner.h"
+
+namespace rst {
+namespace {
+
+constexpr bool IsWhitespace(const char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// Returns true if |c| can't be a part of a number or a literal.
+constexpr bool IsScalarEnd(const char c) {
+  return IsWhitespace(c) || c == ',' || c == ':' || c == '"' || c == '[' ||
+         c == ']' || c == '{' || c == '}';
+}
+
+// Moves through JSON without materializing values. Functions return false on
+// error and store the error message and position.
+class JsonSkipper {
+ public:
+  JsonSkipper(const std::string_view json, const size_t offset)
+      : begin_(json.data()),
+        current_(json.data() + offset),
+        end_(json.data() + json.size()) {}
+
+  size_t offset() const { return static_cast<size_t>(current_ - begin_); }
+
+  void SkipWhitespace() {
+    while (current_ != end_ && IsWhitespace(*current_))
+      current_++;
+  }
+
+  // Skips |c| if it's the current character.
+  bool Consume(const char c) {
+    if (current_ == end_ || *current_ != c)
+      return false;
+
+    current_++;
+    return true;
+  }
+
+  bool Fail(const std::string_view message) {
+    error_message_ = message;
+    return false;
+  }
+
+  Status MakeError() const {
+    return MakeStatus<JsonParseError>(error_message_, offset());
+  }
+
+  bool SkipValue() {
+    if (RST_UNLIKELY(current_ == end_))
+      return Fail("Unexpected end of input");
+
+    switch (*current_) {
+      case '"':
+        return SkipString();
+      case '[':
+      case '{':
+        return SkipContainer();
+      default:
+        return SkipScalar();
+    }
+  }
+
+  // Skips a string and stores its raw contents without quotes in |string|.
+  bool SkipString(const NotNull<std::string_view*> string) {
+    const auto string_begin = current_ + 1;
+    if (!SkipString())
+      return false;
+
+    *string = std::string_view(
+        string_begin, static_cast<size_t>(current_ - 1 - string_begin));
+    return true;
+  }
+
+ private:
+  bool SkipString() {
+    current_++;  // '"'.
+
+    while (true) {
+      current_ = internal::FindJsonStringSpecialChar(current_, end_);
+      if (RST_UNLIKELY(current_ == end_))
+        return Fail("Unterminated string");
+
+      if (*current_ == '"') {
+        current_++;
+        return true;
+      }
+
+      if (*current_ != '\\')
+        return Fail("Control character in string");
+
+      if (end_ - current_ < 2) {
+        current_ = end_;
+        return Fail("Unterminated string");
+      }
+
+      current_ += 2;
+    }
+  }
+
+  bool SkipContainer() {
+    // Number of bits in |is_array|.
+    static constexpr size_t kInlineDepth = 64;
+
+    // Whether the open containers are arrays, the innermost one in the lowest
+    // bit. The outer containers beyond |kInlineDepth| are kept in
+    // |outer_is_array|, so only unusually deep values allocate.
+    uint64_t is_array = 0;
+    std::vector<bool> outer_is_array;
+    size_t depth = 0;
+    while (current_ != end_) {
+      const auto c = *current_;
+      switch (c) {
+        case '"':
+          if (!SkipString())
+            return false;
+          continue;
+        case '[':
+        case '{':
+          if (depth >= kInlineDepth)
+            outer_is_array.push_back((is_array >> (kInlineDepth - 1)) != 0);
+          is_array = (is_array << 1) | uint64_t{c == '['};
+          depth++;
+          break;
+        case ']':
+        case '}':
+          if ((is_array & 1) != uint64_t{c == ']'})
+            return Fail("Mismatched bracket");
+
+          is_array >>= 1;
+          depth--;
+          if (depth >= kInlineDepth) {
+            is_array |= uint64_t{outer_is_array.back()} << (kInlineDepth - 1);
+            outer_is_array.pop_back();
+          }
+
+          if (depth == 0) {
+            current_++;
+            return true;
+          }
+          break;
+        default:
+          break;
+      }
+
+      current_++;
+    }
+
+    return Fail("Unexpected end of input");
+  }
+
+  bool SkipScalar() {
+    const auto scalar_begin = current_;
+    while (current_ != end_ && !IsScalarEnd(*current_))
+      current_++;
+
+    if (current_ == scalar_begin)
+      return Fail("Unexpected character");
+
+    return true;
+  }
+
+  const char* const begin_;
+  const char* current_;
+  const char* const end_;
+  std::string_view error_message_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonSkipper);
+};
+
+}  // namespace
+
+JsonCursor::JsonCursor(const std::string_view json) : JsonCursor(json, 0) {}
+
+JsonCursor::JsonCursor(const std::string_view json, const size_t offset)
+    : json_(json), offset_(offset) {}
+
+StatusOr<Value::Type> JsonCursor::GetType() const {
+  JsonSkipper skipper(json_, offset_);
+  skipper.SkipWhitespace();
+  const auto offset = skipper.offset();
+  if (RST_UNLIKELY(offset == json_.size()))
+    return MakeStatus<JsonParseError>("Unexpected end of input", offset);
+
+  switch (json_[offset]) {
+    case 'n':
+      return Value::Type::kNull;
+    case 't':
+    case 'f':
+      return Value::Type::kBool;
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+      return Value::Type::kNumber;
+    case '"':
+      return Value::Type::kString;
+    case '[':
+      return Value::Type::kArray;
+    case '{':
+      return Value::Type::kObject;
+    default:
+      return MakeStatus<JsonParseError>("Unexpected character", offset);
+  }
+}
+
+StatusOr<std::optional<JsonCursor>> JsonCursor::FindKey(
+    const std::string_view key) const {
+  JsonSkipper skipper(json_, offset_);
+  skipper.SkipWhitespace();
+  if (!skipper.Consume('{'))
+    return MakeStatus<JsonParseError>("Expected object", skipper.offset());
+
+  skipper.SkipWhitespace();
+  if (skipper.Consume('}'))
+    return std::optional<JsonCursor>();
+
+  while (true) {
+    const auto key_offset = skipper.offset();
+    if (key_offset == json_.size() || json_[key_offset] != '"')
+      return MakeStatus<JsonParseError>("Expected string key", key_offset);
+
+    std::string_view raw_key;
+    if (!skipper.SkipString(&raw_key))
+      return skipper.MakeError();
+
+    auto is_found = false;
+    if (raw_key.find('\\') == std::string_view::npos) {
+      is_found = raw_key == key;
+    } else {
+      Value decoded_key;
+      size_t end = 0;
+      RST_TRY(internal::ParseJsonValue(json_, key_offset, 0, JsonMaxDepth(1),
+                                       &decoded_key, &end));
+      is_found = std::string_view(decoded_key.GetString()) == key;
+    }
+
+    skipper.SkipWhitespace();
+    if (!skipper.Consume(':'))
+      return MakeStatus<JsonParseError>("Expected ':'", skipper.offset());
+
+    skipper.SkipWhitespace();
+    if (is_found)
+      return std::optional<JsonCursor>(JsonCursor(json_, skipper.offset()));
+
+    if (!skipper.SkipValue())
+      return skipper.MakeError();
+
+    skipper.SkipWhitespace();
+    if (skipper.Consume(',')) {
+      skipper.SkipWhitespace();
+      continue;
+    }
+
+    if (skipper.Consume('}'))
+      return std::optional<JsonCursor>();
+
+    return MakeStatus<JsonParseError>("Expected ',' or '}'", skipper.offset());
+  }
+}
+
+StatusOr<std::optional<JsonCursor>> JsonCursor::FindPath(
+    const Value::Path& path) const {
+  auto cursor = *this;
+  for (const auto& key : path.keys()) {
+    RST_TRY_CREATE(auto, child, cursor.FindKey(key));
+    if (!child->has_value())
+      return std::optional<JsonCursor>();
+
+    cursor = **child;
+  }
+
+  return std::optional<JsonCursor>(cursor);
+}
+
+StatusOr<std::optional<JsonCursor>> JsonCursor::At(const size_t index) const {
+  JsonSkipper skipper(json_, offset_);
+  skipper.SkipWhitespace();
+  if (!skipper.Consume('['))
+    return MakeStatus<JsonParseError>("Expected array", skipper.offset());
+
+  skipper.SkipWhitespace();
+  if (skipper.Consume(']'))
+    return std::optional<JsonCursor>();
+
+  for (size_t i = 0;; i++) {
+    if (i == index)
+      return std::optional<JsonCursor>(JsonCursor(json_, skipper.offset()));
+
+    if (!skipper.SkipValue())
+      return skipper.MakeError();
+
+    skipper.SkipWhitespace();
+    if (skipper.Consume(',')) {
+      skipper.SkipWhitespace();
+      continue;
+    }
+
+    if (skipper.Consume(']'))
+      return std::optional<JsonCursor>();
+
+    return MakeStatus<JsonParseError>("Expected ',' or ']'", skipper.offset());
+  }
+}
+
+StatusOr<Value> JsonCursor::ToValue(const JsonMaxDepth max_depth) const {
+  JsonSkipper skipper(json_, offset_);
+  skipper.SkipWhitespace();
+
+  Value value;
+  size_t end = 0;
+  RST_TRY(internal::ParseJsonValue(json_, skipper.offset(), 0, max_depth,
+                                   &value, &end));
+  return value;
+}
+
+}  // namespace rst
@@ -0,0 +1,106 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_JSON_CURSOR_H_
+#define RST_VALUE_JSON_CURSOR_H_
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include "rst/status/status_or.h"
+#include "rst/value/json_reader.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Lazy read-only access to a JSON document without building a `rst::Value`.
+// A cursor points to a value inside of an unparsed buffer, e.g. a memory
+// mapped file, which must outlive the cursor and the cursors derived from it.
+// Cursors are cheap to copy.
+//
+// `FindKey()` and `At()` move to a member of an object or an element of an
+// array by skipping the preceding values. Skipped values are only checked for
+// terminated strings and matching brackets, values that are read by
+// `ToValue()` are checked fully. So the cost of a lookup is close to the
+// number of the skipped bytes, and only the values that are read are
+// materialized. Errors are `rst::JsonParseError` with the offset in the
+// whole buffer.
+//
+// Unlike `rst::ParseJson()`, `FindKey()` returns the first member with a given
+// key if the key is duplicated, and the data after the root value is not
+// checked.
+//
+// Example:
+//
+//   #include "rst/value/json_cursor.h"
+//
+//   rst::JsonCursor cursor(json);
+//   rst::StatusOr<std::optional<rst::JsonCursor>> id =
+//       cursor.FindPath(rst::Value::Path("user.id"));
+//   if (id.err())
+//     return std::move(id).TakeStatus();
+//   if (!id->has_value())
+//     return ...;  // No such member.
+//
+//   rst::StatusOr<rst::Value> value = (*id)->ToValue();
+//
+class JsonCursor {
+ public:
+  // Points to the root value of |json|.
+  explicit JsonCursor(std::string_view json);
+
+  // Returns the type of the value judging by its first character.
+  StatusOr<Value::Type> GetType() const;
+
+  // Returns a cursor to the member of an object with |key|, or std::nullopt if
+  // there is no such member. Returns an error if the value is not an object.
+  StatusOr<std::optional<JsonCursor>> FindKey(std::string_view key) const;
+
+  // Like FindKey(), but follows all the keys of |path|.
+  StatusOr<std::optional<JsonCursor>> FindPath(const Value::Path& path) const;
+
+  // Returns a cursor to the element of an array with |index|, or std::nullopt
+  // if the array is shorter. Returns an error if the value is not an array.
+  StatusOr<std::optional<JsonCursor>> At(size_t index) const;
+
+  // Parses the value, see `rst::ParseJson()`.
+  StatusOr<Value> ToValue(JsonMaxDepth max_depth = JsonMaxDepth(200)) const;
+
+  // Returns the byte offset of the value in the buffer.
+  size_t offset() const { return offset_; }
+
+ private:
+  JsonCursor(std::string_view json, size_t offset);
+
+  std::string_view json_;
+  size_t offset_ = 0;
+};
+
+}  // namespace rst
+
+#endif  // RST_VALUE_JSON_CURSOR_H_
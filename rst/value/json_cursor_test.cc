@@ -0,0 +1,192 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_cursor.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+constexpr std::string_view kJson = R"( {
+  "id": 42,
+  "skipped": {"a": [1, "]}", {"b": null}], "c": "\"{"},
+  "name": "rst",
+  "escaped\u0041": true,
+  "nested": {"list": [10, [20], 30.5]}
+} )";
+
+std::optional<JsonCursor> FindKey(const JsonCursor& cursor,
+                                  const std::string_view key) {
+  auto result = cursor.FindKey(key);
+  RST_CHECK(!result.err());
+  return *result;
+}
+
+std::optional<JsonCursor> At(const JsonCursor& cursor, const size_t index) {
+  auto result = cursor.At(index);
+  RST_CHECK(!result.err());
+  return *result;
+}
+
+Value ToValue(const std::optional<JsonCursor>& cursor) {
+  RST_CHECK(cursor.has_value());
+  auto value = cursor->ToValue();
+  RST_CHECK(!value.err());
+  return std::move(*value);
+}
+
+Value::Type GetType(const std::optional<JsonCursor>& cursor) {
+  RST_CHECK(cursor.has_value());
+  auto type = cursor->GetType();
+  RST_CHECK(!type.err());
+  return *type;
+}
+
+size_t ErrorOffset(StatusOr<std::optional<JsonCursor>> result) {
+  return GetErrorOffset<JsonParseError>(std::move(result));
+}
+
+}  // namespace
+
+TEST(JsonCursor, FindKey) {
+  const JsonCursor cursor(kJson);
+  EXPECT_EQ(GetType(cursor), Value::Type::kObject);
+
+  EXPECT_EQ(ToValue(FindKey(cursor, "id")).GetInt64(), 42);
+  EXPECT_EQ(std::string_view(ToValue(FindKey(cursor, "name")).GetString()),
+            "rst");
+  EXPECT_TRUE(ToValue(FindKey(cursor, "escapedA")).GetBool());
+  EXPECT_EQ(FindKey(cursor, "escaped"), std::nullopt);
+  EXPECT_EQ(FindKey(cursor, "missing"), std::nullopt);
+
+  const auto skipped = FindKey(cursor, "skipped");
+  EXPECT_EQ(GetType(skipped), Value::Type::kObject);
+  EXPECT_EQ(std::string_view(ToValue(FindKey(*skipped, "c")).GetString()),
+            "\"{");
+
+  EXPECT_EQ(FindKey(JsonCursor("{}"), "key"), std::nullopt);
+}
+
+TEST(JsonCursor, FindPath) {
+  const JsonCursor cursor(kJson);
+  auto list = cursor.FindPath(Value::Path("nested.list"));
+  ASSERT_FALSE(list.err());
+  ASSERT_TRUE(list->has_value());
+  EXPECT_EQ(GetType(*list), Value::Type::kArray);
+
+  auto missing = cursor.FindPath(Value::Path("nested.missing.key"));
+  ASSERT_FALSE(missing.err());
+  EXPECT_EQ(*missing, std::nullopt);
+}
+
+TEST(JsonCursor, At) {
+  const JsonCursor cursor(kJson);
+  auto list = cursor.FindPath(Value::Path("nested.list"));
+  ASSERT_FALSE(list.err());
+  ASSERT_TRUE(list->has_value());
+
+  EXPECT_EQ(ToValue(At(**list, 0)).GetInt(), 10);
+  EXPECT_EQ(ToValue(At(*At(**list, 1), 0)).GetInt(), 20);
+  EXPECT_EQ(ToValue(At(**list, 2)).GetDouble(), 30.5);
+  EXPECT_EQ(At(**list, 3), std::nullopt);
+  EXPECT_EQ(At(JsonCursor(" [ ] "), 0), std::nullopt);
+}
+
+TEST(JsonCursor, ToValue) {
+  const JsonCursor cursor(kJson);
+  const auto skipped = ToValue(FindKey(cursor, "skipped"));
+  const auto a = skipped.FindKey("a");
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(a->GetArray().size(), 3U);
+
+  auto value = cursor.ToValue();
+  ASSERT_FALSE(value.err());
+  auto expected = ParseJson(kJson);
+  ASSERT_FALSE(expected.err());
+  EXPECT_EQ(*value, *expected);
+}
+
+TEST(JsonCursor, GetType) {
+  EXPECT_EQ(GetType(JsonCursor("null")), Value::Type::kNull);
+  EXPECT_EQ(GetType(JsonCursor(" false")), Value::Type::kBool);
+  EXPECT_EQ(GetType(JsonCursor("-1")), Value::Type::kNumber);
+  EXPECT_EQ(GetType(JsonCursor("\"\"")), Value::Type::kString);
+  EXPECT_EQ(GetType(JsonCursor("[]")), Value::Type::kArray);
+  EXPECT_EQ(GetType(JsonCursor("{}")), Value::Type::kObject);
+
+  auto type = JsonCursor("  ").GetType();
+  EXPECT_TRUE(type.err());
+  type = JsonCursor("x").GetType();
+  EXPECT_TRUE(type.err());
+}
+
+TEST(JsonCursor, SkipDeepValue) {
+  std::string openers, closers;
+  for (auto i = 0; i < 100; i++) {
+    openers += i % 3 == 0 ? R"({"a": )" : "[";
+    closers.insert(closers.begin(), i % 3 == 0 ? '}' : ']');
+  }
+
+  const auto json = "[" + openers + closers + ", 1]";
+  EXPECT_EQ(ToValue(At(JsonCursor(json), 1)).GetInt(), 1);
+
+  // The outermost bracket of the skipped value is mismatched.
+  auto mismatched = closers;
+  mismatched.back() = ']';
+  EXPECT_EQ(ErrorOffset(JsonCursor("[" + openers + mismatched + ", 1]").At(1)),
+            openers.size() + closers.size());
+}
+
+TEST(JsonCursor, Errors) {
+  EXPECT_EQ(ErrorOffset(JsonCursor(" [1]").FindKey("key")), 1U);
+  EXPECT_EQ(ErrorOffset(JsonCursor("{}").At(0)), 0U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({"a": 1 "b": 2})").FindKey("b")), 8U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({"a": [1, {"b": 2])").FindKey("b")),
+            17U);
+  EXPECT_EQ(ErrorOffset(JsonCursor("[[}, 1]").At(1)), 2U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({"a": [1}], "b": 2})").FindKey("b")),
+            8U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({"a": "[}", "b": [}]})").FindKey("c")),
+            18U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({"a": "\")").FindKey("b")), 9U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({1: 2})").FindKey("b")), 1U);
+  EXPECT_EQ(ErrorOffset(JsonCursor(R"({"a" 2})").FindKey("b")), 5U);
+  EXPECT_EQ(ErrorOffset(JsonCursor("[1 2]").At(1)), 3U);
+
+  auto value = JsonCursor(R"({"a": tru})").ToValue();
+  EXPECT_TRUE(value.err());
+}
+
+}  // namespace rst
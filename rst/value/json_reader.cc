@@ -0,0 +1,438 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_reader.h"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+#include "rst/macros/optimization.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status_macros.h"
+#include "rst/strings/str_cat.h"
+#include "rst/value/json_scanner.h"
+
+namespace rst {
+namespace {
+
+// Maximum number of digits of an integer that is converted without
+// std::from_chars(). 10^15 < 2^53, so such integers are safe integers and
+// are stored as int64_t.
+constexpr ptrdiff_t kMaxFastIntegerDigits = 15;
+
+constexpr bool IsDigit(const char c) { return c >= '0' && c <= '9'; }
+
+constexpr bool IsWhitespace(const char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// Recursive descent parser. Parsing functions return false on error and store
+// the error message and position.
+class JsonParser {
+ public:
+  // Strings, arrays and objects are allocated from the memory resource of
+  // |allocator|.
+  JsonParser(const std::string_view json, const size_t max_depth,
+             const Value::allocator_type& allocator)
+      : begin_(json.data()),
+        current_(json.data()),
+        end_(json.data() + json.size()),
+        max_depth_(max_depth),
+        allocator_(allocator) {}
+
+  // Parses the whole input into |value|.
+  Status Parse(const NotNull<Value*> value) {
+    SkipWhitespace();
+    if (!ParseValue(value, 0))
+      return MakeError();
+
+    SkipWhitespace();
+    if (current_ != end_) {
+      Fail("Unexpected data after root value");
+      return MakeError();
+    }
+
+    return Status::OK();
+  }
+
+  // Parses a single value that starts at |offset| into |value| and stores the
+  // offset after it in |end|. |base_offset| is added to the error offsets.
+  Status ParseAt(const size_t offset, const size_t base_offset,
+                 const NotNull<Value*> value, const NotNull<size_t*> end) {
+    current_ = begin_ + offset;
+    base_offset_ = base_offset;
+    if (!ParseValue(value, 0))
+      return MakeError();
+
+    *end = static_cast<size_t>(current_ - begin_);
+    return Status::OK();
+  }
+
+ private:
+  bool Fail(const std::string_view message) {
+    error_message_ = message;
+    return false;
+  }
+
+  Status MakeError() const {
+    return MakeStatus<JsonParseError>(
+        error_message_, base_offset_ + static_cast<size_t>(current_ - begin_));
+  }
+
+  void SkipWhitespace() {
+    while (current_ != end_ && IsWhitespace(*current_))
+      current_++;
+  }
+
+  bool ParseValue(const NotNull<Value*> value, const size_t depth) {
+    if (RST_UNLIKELY(current_ == end_))
+      return Fail("Unexpected end of input");
+
+    switch (*current_) {
+      case '{':
+        return ParseObject(value, depth);
+      case '[':
+        return ParseArray(value, depth);
+      case '"': {
+        Value::String string(allocator_);
+        if (!ParseString(&string))
+          return false;
+        *value = Value(std::move(string));
+        return true;
+      }
+      case 't':
+        return ParseLiteral("true", Value(true), value);
+      case 'f':
+        return ParseLiteral("false", Value(false), value);
+      case 'n':
+        return ParseLiteral("null", Value(), value);
+      case '-':
+      case '0':
+      case '1':
+      case '2':
+      case '3':
+      case '4':
+      case '5':
+      case '6':
+      case '7':
+      case '8':
+      case '9':
+        return ParseNumber(value);
+      default:
+        return Fail("Unexpected character");
+    }
+  }
+
+  bool ParseLiteral(const std::string_view literal, Value&& literal_value,
+                    const NotNull<Value*> value) {
+    if (static_cast<size_t>(end_ - current_) < literal.size() ||
+        std::string_view(current_, literal.size()) != literal) {
+      return Fail("Invalid literal");
+    }
+
+    current_ += literal.size();
+    *value = std::move(literal_value);
+    return true;
+  }
+
+  bool ParseArray(const NotNull<Value*> value, const size_t depth) {
+    if (depth >= max_depth_)
+      return Fail("Too deep nesting");
+
+    current_++;  // '['.
+    SkipWhitespace();
+
+    Value::Array array(allocator_);
+    if (current_ != end_ && *current_ == ']') {
+      current_++;
+      *value = Value(std::move(array));
+      return true;
+    }
+
+    while (true) {
+      if (!ParseValue(&array.emplace_back(), depth + 1))
+        return false;
+
+      SkipWhitespace();
+      if (RST_UNLIKELY(current_ == end_))
+        return Fail("Unexpected end of input");
+
+      if (*current_ == ',') {
+        current_++;
+        SkipWhitespace();
+        continue;
+      }
+
+      if (*current_ == ']') {
+        current_++;
+        break;
+      }
+
+      return Fail("Expected ',' or ']'");
+    }
+
+    *value = Value(std::move(array));
+    return true;
+  }
+
+  bool ParseObject(const NotNull<Value*> value, const size_t depth) {
+    if (depth >= max_depth_)
+      return Fail("Too deep nesting");
+
+    current_++;  // '{'.
+    SkipWhitespace();
+
+    // Collects the members unsorted and sorts them once in the end.
+    Value::Object::container_type members(allocator_);
+    if (current_ != end_ && *current_ == '}') {
+      current_++;
+      *value = Value(Value::Object(std::move(members)));
+      return true;
+    }
+
+    while (true) {
+      if (current_ == end_ || *current_ != '"')
+        return Fail("Expected string key");
+
+      Value::String key(allocator_);
+      if (!ParseString(&key))
+        return false;
+
+      SkipWhitespace();
+      if (current_ == end_ || *current_ != ':')
+        return Fail("Expected ':'");
+
+      current_++;
+      SkipWhitespace();
+
+      auto& member = members.emplace_back(std::move(key), Value());
+      if (!ParseValue(&member.second, depth + 1))
+        return false;
+
+      SkipWhitespace();
+      if (RST_UNLIKELY(current_ == end_))
+        return Fail("Unexpected end of input");
+
+      if (*current_ == ',') {
+        current_++;
+        SkipWhitespace();
+        continue;
+      }
+
+      if (*current_ == '}') {
+        current_++;
+        break;
+      }
+
+      return Fail("Expected ',' or '}'");
+    }
+
+    *value = Value(Value::Object(std::move(members)));
+    return true;
+  }
+
+  bool ParseString(const NotNull<Value::String*> out) {
+    current_++;  // '"'.
+
+    auto chunk_begin = current_;
+    while (true) {
+      current_ = internal::FindJsonStringSpecialChar(current_, end_);
+      if (RST_UNLIKELY(current_ == end_))
+        return Fail("Unterminated string");
+
+      if (*current_ == '"') {
+        out->append(chunk_begin, current_);
+        current_++;
+        return true;
+      }
+
+      if (*current_ != '\\')
+        return Fail("Control character in string");
+
+      out->append(chunk_begin, current_);
+      current_++;  // '\\'.
+      std::string_view error_message;
+      if (!internal::DecodeJsonEscape(&current_, end_, out, &error_message))
+        return Fail(error_message);
+
+      chunk_begin = current_;
+    }
+  }
+
+  bool ParseNumber(const NotNull<Value*> value) {
+    const auto number_begin = current_;
+    const auto is_negative = *current_ == '-';
+    if (is_negative)
+      current_++;
+
+    const auto integer_begin = current_;
+    if (current_ == end_ || !IsDigit(*current_))
+      return Fail("Invalid number");
+
+    if (*current_ == '0') {
+      current_++;
+    } else {
+      while (current_ != end_ && IsDigit(*current_))
+        current_++;
+    }
+    const auto integer_end = current_;
+
+    auto fraction_begin = current_;
+    auto fraction_end = current_;
+    if (current_ != end_ && *current_ == '.') {
+      current_++;
+      if (current_ == end_ || !IsDigit(*current_))
+        return Fail("Invalid number");
+
+      fraction_begin = current_;
+      while (current_ != end_ && IsDigit(*current_))
+        current_++;
+      fraction_end = current_;
+    }
+
+    // Saturated since only the sign of the decimal order matters for too big
+    // exponents.
+    int64_t exponent = 0;
+    auto has_exponent = false;
+    if (current_ != end_ && (*current_ == 'e' || *current_ == 'E')) {
+      has_exponent = true;
+      current_++;
+      auto is_exponent_negative = false;
+      if (current_ != end_ && (*current_ == '+' || *current_ == '-')) {
+        is_exponent_negative = *current_ == '-';
+        current_++;
+      }
+
+      if (current_ == end_ || !IsDigit(*current_))
+        return Fail("Invalid number");
+
+      for (; current_ != end_ && IsDigit(*current_); current_++) {
+        if (exponent < 1'000'000)
+          exponent = exponent * 10 + (*current_ - '0');
+      }
+
+      if (is_exponent_negative)
+        exponent = -exponent;
+    }
+
+    if (fraction_begin == fraction_end && !has_exponent &&
+        integer_end - integer_begin <= kMaxFastIntegerDigits) {
+      int64_t integer = 0;
+      for (auto c = integer_begin; c != integer_end; c++)
+        integer = integer * 10 + (*c - '0');
+      *value = Value(is_negative ? -integer : integer);
+      return true;
+    }
+
+    auto number = 0.0;
+    const auto [ptr, ec] = std::from_chars(number_begin, current_, number);
+    RST_DCHECK(ptr == current_);
+    if (ec == std::errc::result_out_of_range) {
+      // Computes the decimal order of the first significant digit to tell an
+      // overflow from an underflow.
+      int64_t order = exponent;
+      if (*integer_begin != '0') {
+        order += integer_end - integer_begin;
+      } else {
+        auto c = fraction_begin;
+        while (c != fraction_end && *c == '0')
+          c++;
+        order -= c - fraction_begin;
+      }
+
+      if (order > 0) {
+        current_ = number_begin;
+        return Fail("Number out of range");
+      }
+
+      number = is_negative ? -0.0 : 0.0;
+    } else {
+      RST_DCHECK(ec == std::errc());
+    }
+
+    *value = Value(number);
+    return true;
+  }
+
+  const char* const begin_;
+  const char* current_;
+  const char* const end_;
+  const size_t max_depth_;
+  const Value::allocator_type allocator_;
+  size_t base_offset_ = 0;
+  std::string_view error_message_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonParser);
+};
+
+}  // namespace
+
+char JsonParseError::id_ = '\0';
+
+JsonParseError::JsonParseError(const std::string_view message,
+                               const size_t offset)
+    : message_(StrCat({message, " at offset ", offset})), offset_(offset) {}
+
+JsonParseError::~JsonParseError() = default;
+
+const std::string& JsonParseError::AsString() const { return message_; }
+
+StatusOr<Value> ParseJson(const std::string_view json,
+                          const JsonMaxDepth max_depth) {
+  JsonParser parser(json, max_depth.value(), Value::allocator_type());
+  Value value;
+  RST_TRY(parser.Parse(&value));
+  return value;
+}
+
+StatusOr<NotNull<Value*>> ParseJson(const std::string_view json,
+                                    const NotNull<ValueArena*> arena,
+                                    const JsonMaxDepth max_depth) {
+  JsonParser parser(json, max_depth.value(), arena->allocator());
+  auto value = arena->New();
+  RST_TRY(parser.Parse(value));
+  return value;
+}
+
+namespace internal {
+
+Status ParseJsonValue(const std::string_view json, const size_t offset,
+                      const size_t base_offset, const JsonMaxDepth max_depth,
+                      const NotNull<Value*> value,
+                      const NotNull<size_t*> end,
+                      const Value::allocator_type& allocator) {
+  RST_DCHECK(offset <= json.size());
+  JsonParser parser(json, max_depth.value(), allocator);
+  return parser.ParseAt(offset, base_offset, value, end);
+}
+
+}  // namespace internal
+
+}  // namespace rst
@@ -0,0 +1,120 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_JSON_READER_H_
+#define RST_VALUE_JSON_READER_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/status/status_or.h"
+#include "rst/type/type.h"
+#include "rst/value/value.h"
+#include "rst/value/value_arena.h"
+
+namespace rst {
+
+class JsonParseError final : public ErrorInfo<JsonParseError> {
+ public:
+  JsonParseError(std::string_view message, size_t offset);
+  ~JsonParseError() override;
+
+  // ErrorInfo:
+  const std::string& AsString() const override;
+
+  // Returns the byte offset in the input where the error has been detected.
+  size_t offset() const { return offset_; }
+
+  static char id_;
+
+ private:
+  const std::string message_;
+  const size_t offset_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonParseError);
+};
+
+// Maximum nesting depth of arrays and objects accepted by `rst::ParseJson()`.
+using JsonMaxDepth = Type<class JsonMaxDepthTag, size_t>;
+
+// Parses RFC 8259 JSON |json| into a `rst::Value`. Returns
+// `rst::JsonParseError` with the byte offset of the error if the input is
+// malformed, contains a number that can't be represented by a finite double,
+// or nests arrays and objects deeper than |max_depth|. Duplicate object keys
+// are allowed, the last one wins.
+//
+// Strings are scanned 8 bytes at a time for quotes, escapes and control
+// characters, numbers are converted exactly and independently of the locale.
+//
+// Example:
+//
+//   #include "rst/value/json_reader.h"
+//
+//   rst::StatusOr<rst::Value> value = rst::ParseJson(R"({"key": [1, 2]})");
+//   if (value.err()) {
+//     // Prints e.g. "Unexpected character at offset 9".
+//     std::cerr << value.status().GetError()->AsString() << std::endl;
+//   }
+//
+StatusOr<Value> ParseJson(std::string_view json,
+                          JsonMaxDepth max_depth = JsonMaxDepth(200));
+
+// Like the function above but allocates the resulting tree from |arena|, which
+// owns it.
+//
+// Example:
+//
+//   #include "rst/value/json_reader.h"
+//
+//   rst::ValueArena arena;
+//   rst::StatusOr<rst::NotNull<rst::Value*>> value =
+//       rst::ParseJson(request_body, &arena);
+//
+StatusOr<NotNull<Value*>> ParseJson(std::string_view json,
+                                    NotNull<ValueArena*> arena,
+                                    JsonMaxDepth max_depth = JsonMaxDepth(200));
+
+namespace internal {
+
+// Parses a single JSON value that starts at byte |offset| of |json| into
+// |value| and stores the offset after the value in |end|. The rest of |json|
+// is not checked. Error offsets are relative to the beginning of |json| plus
+// |base_offset|. Strings, arrays and objects are allocated with |allocator|.
+Status ParseJsonValue(
+    std::string_view json, size_t offset, size_t base_offset,
+    JsonMaxDepth max_depth, NotNull<Value*> value, NotNull<size_t*> end,
+    const Value::allocator_type& allocator = Value::allocator_type());
+
+}  // namespace internal
+
+}  // namespace rst
+
+#endif  // RST_VALUE_JSON_READER_H_
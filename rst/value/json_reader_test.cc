@@ -0,0 +1,174 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_reader.h"
+
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+size_t ErrorOffset(const std::string_view json,
+                   const JsonMaxDepth max_depth = JsonMaxDepth(200)) {
+  return GetErrorOffset<JsonParseError>(ParseJson(json, max_depth));
+}
+
+}  // namespace
+
+TEST(JsonReader, Literals) {
+  EXPECT_TRUE(ParseJsonOrDie("null").IsNull());
+  EXPECT_TRUE(ParseJsonOrDie("true").GetBool());
+  EXPECT_FALSE(ParseJsonOrDie("false").GetBool());
+  EXPECT_TRUE(ParseJsonOrDie(" \t\r\n null \t\r\n ").IsNull());
+}
+
+TEST(JsonReader, Numbers) {
+  EXPECT_EQ(ParseJsonOrDie("0").GetInt(), 0);
+  EXPECT_EQ(ParseJsonOrDie("-0").GetInt(), 0);
+  EXPECT_EQ(ParseJsonOrDie("123").GetInt(), 123);
+  EXPECT_EQ(ParseJsonOrDie("-123").GetInt(), -123);
+  EXPECT_EQ(ParseJsonOrDie("999999999999999").GetInt64(), 999999999999999);
+  EXPECT_EQ(ParseJsonOrDie("9007199254740991").GetInt64(), 9007199254740991);
+  EXPECT_EQ(ParseJsonOrDie("1.5").GetDouble(), 1.5);
+  EXPECT_EQ(ParseJsonOrDie("-0.25").GetDouble(), -0.25);
+  EXPECT_EQ(ParseJsonOrDie("1e3").GetDouble(), 1000.0);
+  EXPECT_EQ(ParseJsonOrDie("1E+3").GetDouble(), 1000.0);
+  EXPECT_EQ(ParseJsonOrDie("25e-2").GetDouble(), 0.25);
+  EXPECT_EQ(ParseJsonOrDie("0.1").GetDouble(), 0.1);
+  EXPECT_EQ(ParseJsonOrDie("2.2250738585072014e-308").GetDouble(),
+            2.2250738585072014e-308);
+  EXPECT_EQ(ParseJsonOrDie("1.7976931348623157e308").GetDouble(),
+            1.7976931348623157e308);
+  EXPECT_EQ(ParseJsonOrDie("1e-400").GetDouble(), 0.0);
+  EXPECT_EQ(ParseJsonOrDie("-0.0000001e-400").GetDouble(), 0.0);
+}
+
+TEST(JsonReader, Strings) {
+  EXPECT_EQ(ParseJsonOrDie(R"("")").GetString(), "");
+  EXPECT_EQ(ParseJsonOrDie(R"("foobar")").GetString(), "foobar");
+  EXPECT_EQ(ParseJsonOrDie(R"("a\"b\\c\/d\be\ff\ng\rh\ti")").GetString(),
+            "a\"b\\c/d\be\ff\ng\rh\ti");
+  EXPECT_EQ(ParseJsonOrDie(R"("Aé€")").GetString(),
+            "A\xc3\xa9\xe2\x82\xac");
+  EXPECT_EQ(ParseJsonOrDie(R"("😀")").GetString(), "\xf0\x9f\x98\x80");
+  EXPECT_EQ(ParseJsonOrDie("\"\xc3\xa9\"").GetString(), "\xc3\xa9");
+}
+
+TEST(JsonReader, LongStrings) {
+  for (auto i = 0; i < 40; i++) {
+    const std::string prefix(static_cast<size_t>(i), 'a');
+    EXPECT_EQ(
+        std::string_view(ParseJsonOrDie("\"" + prefix + "\"").GetString()),
+        prefix);
+    EXPECT_EQ(std::string_view(
+                  ParseJsonOrDie("\"" + prefix + "\\n" + prefix + "\"")
+                      .GetString()),
+              prefix + "\n" + prefix);
+    EXPECT_EQ(ErrorOffset("\"" + prefix + "\x01" + prefix + "\""),
+              static_cast<size_t>(i) + 1);
+  }
+}
+
+TEST(JsonReader, Arrays) {
+  EXPECT_TRUE(ParseJsonOrDie("[]").GetArray().empty());
+  EXPECT_TRUE(ParseJsonOrDie("[ ]").GetArray().empty());
+
+  Value::Array expected;
+  expected.emplace_back(1);
+  expected.emplace_back("two");
+  expected.emplace_back(Value::Type::kArray);
+  expected.emplace_back();
+  EXPECT_EQ(ParseJsonOrDie(R"([1, "two", [], null])"),
+            Value(std::move(expected)));
+}
+
+TEST(JsonReader, Objects) {
+  EXPECT_TRUE(ParseJsonOrDie("{}").GetObject().empty());
+  EXPECT_TRUE(ParseJsonOrDie("{ }").GetObject().empty());
+
+  const auto value = ParseJsonOrDie(R"({"b": {"c": [true]}, "a": 1.5})");
+  EXPECT_EQ(value.FindDoubleKey("a"), 1.5);
+  const auto c = value.FindPath("b.c");
+  ASSERT_NE(c, nullptr);
+  ASSERT_EQ(c->GetArray().size(), 1U);
+  EXPECT_TRUE(c->GetArray().front().GetBool());
+}
+
+TEST(JsonReader, DuplicateKeys) {
+  const auto value = ParseJsonOrDie(R"({"a": 1, "b": 2, "a": 3})");
+  EXPECT_EQ(value.GetObject().size(), 2U);
+  EXPECT_EQ(value.FindIntKey("a"), 3);
+}
+
+TEST(JsonReader, MaxDepth) {
+  EXPECT_FALSE(ParseJson("[[1]]", JsonMaxDepth(2)).err());
+  EXPECT_FALSE(ParseJson(R"({"a": {}})", JsonMaxDepth(2)).err());
+  EXPECT_FALSE(ParseJson("1", JsonMaxDepth(0)).err());
+
+  EXPECT_EQ(ErrorOffset("[[[1]]]", JsonMaxDepth(2)), 2U);
+  EXPECT_EQ(ErrorOffset("{}", JsonMaxDepth(0)), 0U);
+
+  const std::string deep(100000, '[');
+  EXPECT_EQ(ErrorOffset(deep), 200U);
+}
+
+TEST(JsonReader, Errors) {
+  EXPECT_EQ(ErrorOffset(""), 0U);
+  EXPECT_EQ(ErrorOffset("  "), 2U);
+  EXPECT_EQ(ErrorOffset("nul"), 0U);
+  EXPECT_EQ(ErrorOffset("truex"), 4U);
+  EXPECT_EQ(ErrorOffset("[1,]"), 3U);
+  EXPECT_EQ(ErrorOffset("[1 2]"), 3U);
+  EXPECT_EQ(ErrorOffset("[1"), 2U);
+  EXPECT_EQ(ErrorOffset("{1: 2}"), 1U);
+  EXPECT_EQ(ErrorOffset(R"({"a" 2})"), 5U);
+  EXPECT_EQ(ErrorOffset(R"({"a": 2,})"), 8U);
+  EXPECT_EQ(ErrorOffset(R"("abc)"), 4U);
+  EXPECT_EQ(ErrorOffset(R"("\x")"), 2U);
+  EXPECT_EQ(ErrorOffset(R"("\u12G4")"), 5U);
+  EXPECT_EQ(ErrorOffset(R"("\ud83d")"), 7U);
+  EXPECT_EQ(ErrorOffset(R"("\ude00")"), 7U);
+  EXPECT_EQ(ErrorOffset("01"), 1U);
+  EXPECT_EQ(ErrorOffset("-"), 1U);
+  EXPECT_EQ(ErrorOffset("1."), 2U);
+  EXPECT_EQ(ErrorOffset("1e"), 2U);
+  EXPECT_EQ(ErrorOffset("+1"), 0U);
+  EXPECT_EQ(ErrorOffset(".5"), 0U);
+  EXPECT_EQ(ErrorOffset("[1e400]"), 1U);
+
+  auto value = ParseJson("[1,]");
+  ASSERT_TRUE(value.err());
+  EXPECT_EQ(value.status().GetError()->AsString(),
+            "Unexpected character at offset 3");
+}
+
+}  // namespace rst
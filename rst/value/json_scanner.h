@@ -0,0 +1,220 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_JSON_SCANNER_H_
+#define RST_VALUE_JSON_SCANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "rst/not_null/not_null.h"
+
+namespace rst {
+namespace internal {
+
+// Word-at-a-time (SWAR) helpers used by the JSON reader and writer to skip
+// ordinary string bytes 8 at a time.
+
+inline constexpr uint64_t kJsonOnes = 0x0101010101010101;
+inline constexpr uint64_t kJsonHighBits = 0x8080808080808080;
+
+// Returns non-zero if any byte of |word| is less than |n|, |n| <= 128.
+constexpr uint64_t HasLessByte(const uint64_t word, const uint64_t n) {
+  return (word - kJsonOnes * n) & ~word & kJsonHighBits;
+}
+
+// Returns non-zero if any byte of |word| is equal to |c|.
+constexpr uint64_t HasByte(const uint64_t word, const uint64_t c) {
+  return HasLessByte(word ^ (kJsonOnes * c), 1);
+}
+
+// Returns non-zero if any byte of |word| is a quote, a backslash or a control
+// character, i.e. a byte that ends an unescaped run of a JSON string.
+constexpr uint64_t HasJsonStringSpecialByte(const uint64_t word) {
+  return HasByte(word, '"') | HasByte(word, '\\') | HasLessByte(word, 0x20);
+}
+
+constexpr bool IsJsonStringSpecialChar(const char c) {
+  return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+inline uint64_t LoadWord(const NotNull<const char*> ptr) {
+  uint64_t word = 0;
+  std::memcpy(&word, ptr.get(), sizeof(word));
+  return word;
+}
+
+// Returns the first special JSON string character in [begin, end) or |end|.
+inline const char* FindJsonStringSpecialChar(const char* begin,
+                                             const char* const end) {
+  while (end - begin >= static_cast<ptrdiff_t>(sizeof(uint64_t)) &&
+         !HasJsonStringSpecialByte(LoadWord(begin))) {
+    begin += sizeof(uint64_t);
+  }
+
+  while (begin != end && !IsJsonStringSpecialChar(*begin))
+    begin++;
+
+  return begin;
+}
+
+template <class String>
+void AppendUtf8(const uint32_t code_point, const NotNull<String*> out) {
+  if (code_point < 0x80) {
+    *out += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    *out += static_cast<char>(0xc0 | (code_point >> 6));
+    *out += static_cast<char>(0x80 | (code_point & 0x3f));
+  } else if (code_point < 0x10000) {
+    *out += static_cast<char>(0xe0 | (code_point >> 12));
+    *out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+    *out += static_cast<char>(0x80 | (code_point & 0x3f));
+  } else {
+    *out += static_cast<char>(0xf0 | (code_point >> 18));
+    *out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+    *out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+    *out += static_cast<char>(0x80 | (code_point & 0x3f));
+  }
+}
+
+// Decodes XXXX of a \uXXXX escape sequence at |*current|.
+inline bool DecodeJsonHex4(const NotNull<const char**> current,
+                           const char* const end,
+                           const NotNull<uint32_t*> code_unit) {
+  if (end - *current < 4)
+    return false;
+
+  uint32_t result = 0;
+  for (auto i = 0; i < 4; i++, (*current)++) {
+    const auto c = **current;
+    result <<= 4;
+    if (c >= '0' && c <= '9') {
+      result |= static_cast<uint32_t>(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      result |= static_cast<uint32_t>(c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      result |= static_cast<uint32_t>(c - 'A' + 10);
+    } else {
+      return false;
+    }
+  }
+
+  *code_unit = result;
+  return true;
+}
+
+// Decodes an escape sequence that starts after a backslash at |*current| and
+// appends it to |out| as UTF-8. On error returns false, stores the message in
+// |error| and leaves |*current| at the position of the error.
+template <class String>
+bool DecodeJsonEscape(const NotNull<const char**> current,
+                      const char* const end, const NotNull<String*> out,
+                      const NotNull<std::string_view*> error) {
+  if (*current == end) {
+    *error = "Unterminated string";
+    return false;
+  }
+
+  switch (**current) {
+    case '"':
+      *out += '"';
+      break;
+    case '\\':
+      *out += '\\';
+      break;
+    case '/':
+      *out += '/';
+      break;
+    case 'b':
+      *out += '\b';
+      break;
+    case 'f':
+      *out += '\f';
+      break;
+    case 'n':
+      *out += '\n';
+      break;
+    case 'r':
+      *out += '\r';
+      break;
+    case 't':
+      *out += '\t';
+      break;
+    case 'u': {
+      (*current)++;
+      uint32_t code_point = 0;
+      if (!DecodeJsonHex4(current, end, &code_point)) {
+        *error = "Invalid unicode escape";
+        return false;
+      }
+
+      if (code_point >= 0xdc00 && code_point <= 0xdfff) {
+        *error = "Unpaired surrogate";
+        return false;
+      }
+
+      if (code_point >= 0xd800 && code_point <= 0xdbff) {
+        if (end - *current < 2 || (*current)[0] != '\\' ||
+            (*current)[1] != 'u') {
+          *error = "Unpaired surrogate";
+          return false;
+        }
+
+        *current += 2;
+        uint32_t low_surrogate = 0;
+        if (!DecodeJsonHex4(current, end, &low_surrogate)) {
+          *error = "Invalid unicode escape";
+          return false;
+        }
+
+        if (low_surrogate < 0xdc00 || low_surrogate > 0xdfff) {
+          *error = "Unpaired surrogate";
+          return false;
+        }
+
+        code_point =
+            0x10000 + ((code_point - 0xd800) << 10) + (low_surrogate - 0xdc00);
+      }
+
+      AppendUtf8(code_point, out);
+      return true;
+    }
+    default:
+      *error = "Invalid escape sequence";
+      return false;
+  }
+
+  (*current)++;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace rst
+
+#endif  // RST_VALUE_JSON_SCANNER_H_
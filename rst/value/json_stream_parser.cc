@@ -0,0 +1,472 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_stream_parser.h"
+
+#include <utility>
+
+#include "rst/check/check.h"
+#include "rst/macros/optimization.h"
+#include "rst/status/status_macros.h"
+#include "rst/value/json_scanner.h"
+
+namespace rst {
+namespace {
+
+constexpr bool IsWhitespace(const char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// Returns true if |c| can't be a part of a number or a literal.
+constexpr bool IsScalarEnd(const char c) {
+  return IsWhitespace(c) || c == ',' || c == ':' || c == '"' || c == '[' ||
+         c == ']' || c == '{' || c == '}';
+}
+
+}  // namespace
+
+JsonHandler::~JsonHandler() = default;
+
+JsonStreamParser::JsonStreamParser(const NotNull<JsonHandler*> handler,
+                                   const JsonMaxDepth max_depth)
+    : handler_(handler), max_depth_(max_depth.value()) {}
+
+JsonStreamParser::~JsonStreamParser() = default;
+
+Status JsonStreamParser::Parse(const std::string_view chunk) {
+  chunk_begin_ = chunk.data();
+  const auto end = chunk.data() + chunk.size();
+  auto current = chunk.data();
+
+  if (token_ != Token::kNone) {
+    const auto token_end = token_ == Token::kScalar ? ScanScalar(current, end)
+                                                    : ScanString(current, end);
+    if (token_end == nullptr) {
+      token_buffer_.append(current, end);
+      chunk_offset_ += chunk.size();
+      return Status::OK();
+    }
+
+    token_buffer_.append(current, token_end);
+    current = token_end;
+    const auto token = token_;
+    token_ = Token::kNone;
+    RST_TRY(ProcessToken(token, token_buffer_, token_offset_));
+  }
+
+  while (true) {
+    const auto whitespace_begin = current;
+    while (current != end && IsWhitespace(*current))
+      current++;
+    if (current != whitespace_begin && state_ == State::kAfterValue &&
+        stack_.empty()) {
+      is_root_value_separated_ = true;
+    }
+    if (current == end)
+      break;
+
+    const auto c = *current;
+    switch (state_) {
+      case State::kAfterValue: {
+        if (stack_.empty()) {
+          if (!is_root_value_separated_)
+            return Fail("Expected whitespace", GetOffset(current));
+
+          // The next value of the sequence.
+          is_root_value_separated_ = false;
+          state_ = State::kValue;
+          continue;
+        }
+
+        const auto is_array = stack_.back() == Value::Type::kArray;
+        if (c == ',') {
+          current++;
+          state_ = is_array ? State::kValue : State::kKey;
+          continue;
+        }
+
+        if ((is_array && c == ']') || (!is_array && c == '}')) {
+          current++;
+          RST_TRY(Close());
+          continue;
+        }
+
+        return Fail(is_array ? "Expected ',' or ']'" : "Expected ',' or '}'",
+                    GetOffset(current));
+      }
+
+      case State::kColon: {
+        if (c != ':')
+          return Fail("Expected ':'", GetOffset(current));
+
+        current++;
+        state_ = State::kValue;
+        continue;
+      }
+
+      case State::kFirstKeyOrEnd: {
+        if (c == '}') {
+          current++;
+          RST_TRY(Close());
+          continue;
+        }
+        [[fallthrough]];
+      }
+
+      case State::kKey: {
+        if (c != '"')
+          return Fail("Expected string key", GetOffset(current));
+
+        RST_TRY(StartToken(Token::kKey, &current, end));
+        continue;
+      }
+
+      case State::kFirstValueOrEnd: {
+        if (c == ']') {
+          current++;
+          RST_TRY(Close());
+          continue;
+        }
+        [[fallthrough]];
+      }
+
+      case State::kValue: {
+        switch (c) {
+          case '[':
+            RST_TRY(Open(Value::Type::kArray, GetOffset(current)));
+            current++;
+            continue;
+          case '{':
+            RST_TRY(Open(Value::Type::kObject, GetOffset(current)));
+            current++;
+            continue;
+          case '"':
+            RST_TRY(StartToken(Token::kString, &current, end));
+            continue;
+          default:
+            if (IsScalarEnd(c))
+              return Fail("Unexpected character", GetOffset(current));
+
+            RST_TRY(StartToken(Token::kScalar, &current, end));
+            continue;
+        }
+      }
+    }
+  }
+
+  chunk_offset_ += chunk.size();
+  return Status::OK();
+}
+
+Status JsonStreamParser::Finish() {
+  if (token_ == Token::kScalar) {
+    token_ = Token::kNone;
+    RST_TRY(ProcessScalar(token_buffer_, token_offset_));
+  } else if (token_ != Token::kNone) {
+    return Fail("Unterminated string", chunk_offset_);
+  }
+
+  if (!stack_.empty() || state_ != State::kAfterValue)
+    return Fail("Unexpected end of input", chunk_offset_);
+
+  return Status::OK();
+}
+
+Status JsonStreamParser::Fail(const std::string_view message,
+                              const size_t offset) const {
+  return MakeStatus<JsonParseError>(message, offset);
+}
+
+size_t JsonStreamParser::GetOffset(const char* const position) const {
+  return chunk_offset_ + static_cast<size_t>(position - chunk_begin_);
+}
+
+Status JsonStreamParser::StartToken(const Token token,
+                                    const NotNull<const char**> current,
+                                    const char* const end) {
+  const auto token_begin = *current;
+  is_escaped_ = false;
+  const auto token_end = token == Token::kScalar
+                             ? ScanScalar(token_begin, end)
+                             : ScanString(token_begin + 1, end);
+  if (token_end == nullptr) {
+    token_ = token;
+    token_offset_ = GetOffset(token_begin);
+    token_buffer_.assign(token_begin, end);
+    *current = end;
+    return Status::OK();
+  }
+
+  *current = token_end;
+  const std::string_view raw(token_begin,
+                             static_cast<size_t>(token_end - token_begin));
+  return ProcessToken(token, raw, GetOffset(token_begin));
+}
+
+const char* JsonStreamParser::ScanString(const char* begin,
+                                         const char* const end) {
+  if (is_escaped_) {
+    if (begin == end)
+      return nullptr;
+
+    is_escaped_ = false;
+    begin++;
+  }
+
+  while (true) {
+    begin = internal::FindJsonStringSpecialChar(begin, end);
+    if (begin == end)
+      return nullptr;
+
+    if (*begin == '"')
+      return begin + 1;
+
+    if (*begin == '\\') {
+      begin++;
+      if (begin == end) {
+        is_escaped_ = true;
+        return nullptr;
+      }
+    }
+
+    // Skips an escaped character or a control character that is reported
+    // while decoding.
+    begin++;
+  }
+}
+
+// static
+const char* JsonStreamParser::ScanScalar(const char* begin,
+                                         const char* const end) {
+  while (begin != end && !IsScalarEnd(*begin))
+    begin++;
+
+  if (begin == end)
+    return nullptr;
+
+  return begin;
+}
+
+Status JsonStreamParser::ProcessToken(const Token token,
+                                      const std::string_view raw,
+                                      const size_t offset) {
+  if (token == Token::kScalar)
+    return ProcessScalar(raw, offset);
+
+  std::string_view string;
+  RST_TRY(DecodeString(raw, offset, &string));
+  if (token == Token::kKey) {
+    state_ = State::kColon;
+    return handler_->OnKey(string);
+  }
+
+  state_ = State::kAfterValue;
+  return handler_->OnString(string);
+}
+
+Status JsonStreamParser::ProcessScalar(const std::string_view raw,
+                                       const size_t offset) {
+  Value value;
+  size_t end = 0;
+  RST_TRY(internal::ParseJsonValue(raw, 0, offset, JsonMaxDepth(max_depth_),
+                                   &value, &end));
+  if (end != raw.size())
+    return Fail("Unexpected character", offset + end);
+
+  state_ = State::kAfterValue;
+  switch (value.type()) {
+    case Value::Type::kNull:
+      return handler_->OnNull();
+    case Value::Type::kBool:
+      return handler_->OnBool(value.GetBool());
+    case Value::Type::kNumber:
+      return handler_->OnNumber(value);
+    case Value::Type::kString:
+    case Value::Type::kArray:
+    case Value::Type::kObject:
+      break;
+  }
+
+  RST_NOTREACHED();
+  return Status::OK();
+}
+
+Status JsonStreamParser::DecodeString(
+    const std::string_view raw, const size_t offset,
+    const NotNull<std::string_view*> string) {
+  RST_DCHECK(raw.size() >= 2);
+  const auto begin = raw.data() + 1;
+  const auto end = raw.data() + raw.size() - 1;
+
+  auto current = begin;
+  auto chunk_begin = begin;
+  auto is_unescaped = false;
+  while (true) {
+    current = internal::FindJsonStringSpecialChar(current, end);
+    if (current == end)
+      break;
+
+    if (*current != '\\') {
+      return Fail("Control character in string",
+                  offset + static_cast<size_t>(current - raw.data()));
+    }
+
+    if (!is_unescaped) {
+      string_buffer_.clear();
+      is_unescaped = true;
+    }
+
+    string_buffer_.append(chunk_begin, current);
+    current++;  // '\\'.
+    std::string_view error_message;
+    if (!internal::DecodeJsonEscape<std::string>(
+            &current, end, &string_buffer_, &error_message)) {
+      return Fail(error_message,
+                  offset + static_cast<size_t>(current - raw.data()));
+    }
+
+    chunk_begin = current;
+  }
+
+  if (!is_unescaped) {
+    *string = std::string_view(begin, static_cast<size_t>(end - begin));
+    return Status::OK();
+  }
+
+  string_buffer_.append(chunk_begin, end);
+  *string = string_buffer_;
+  return Status::OK();
+}
+
+Status JsonStreamParser::Open(const Value::Type type, const size_t offset) {
+  if (stack_.size() >= max_depth_)
+    return Fail("Too deep nesting", offset);
+
+  stack_.emplace_back(type);
+  if (type == Value::Type::kArray) {
+    state_ = State::kFirstValueOrEnd;
+    return handler_->OnStartArray();
+  }
+
+  state_ = State::kFirstKeyOrEnd;
+  return handler_->OnStartObject();
+}
+
+Status JsonStreamParser::Close() {
+  const auto type = stack_.back();
+  stack_.pop_back();
+  state_ = State::kAfterValue;
+  if (type == Value::Type::kArray)
+    return handler_->OnEndArray();
+
+  return handler_->OnEndObject();
+}
+
+JsonValueBuilder::Container::Container(const Value::Type type) : type(type) {}
+
+JsonValueBuilder::Container::~Container() = default;
+
+JsonValueBuilder::Container::Container(Container&&) noexcept = default;
+
+JsonValueBuilder::Container& JsonValueBuilder::Container::operator=(
+    Container&&) noexcept = default;
+
+JsonValueBuilder::JsonValueBuilder() = default;
+
+JsonValueBuilder::~JsonValueBuilder() = default;
+
+Value JsonValueBuilder::TakeValue() {
+  RST_DCHECK(has_value_);
+  has_value_ = false;
+  return std::move(value_);
+}
+
+Status JsonValueBuilder::OnNull() { return Add(Value()); }
+
+Status JsonValueBuilder::OnBool(const bool value) { return Add(Value(value)); }
+
+Status JsonValueBuilder::OnNumber(const Value& number) {
+  RST_DCHECK(number.IsNumber());
+  return Add(number.Clone());
+}
+
+Status JsonValueBuilder::OnString(const std::string_view value) {
+  return Add(Value(value));
+}
+
+Status JsonValueBuilder::OnStartArray() {
+  RST_DCHECK(!has_value_);
+  stack_.emplace_back(Value::Type::kArray);
+  return Status::OK();
+}
+
+Status JsonValueBuilder::OnEndArray() { return Close(Value::Type::kArray); }
+
+Status JsonValueBuilder::OnStartObject() {
+  RST_DCHECK(!has_value_);
+  stack_.emplace_back(Value::Type::kObject);
+  return Status::OK();
+}
+
+Status JsonValueBuilder::OnKey(const std::string_view key) {
+  RST_DCHECK(!stack_.empty());
+  RST_DCHECK(stack_.back().type == Value::Type::kObject);
+  stack_.back().key = key;
+  return Status::OK();
+}
+
+Status JsonValueBuilder::OnEndObject() { return Close(Value::Type::kObject); }
+
+Status JsonValueBuilder::Add(Value&& value) {
+  RST_DCHECK(!has_value_);
+  if (stack_.empty()) {
+    value_ = std::move(value);
+    has_value_ = true;
+    return Status::OK();
+  }
+
+  auto& container = stack_.back();
+  if (container.type == Value::Type::kArray)
+    container.array.emplace_back(std::move(value));
+  else
+    container.members.emplace_back(std::move(container.key), std::move(value));
+
+  return Status::OK();
+}
+
+Status JsonValueBuilder::Close(const Value::Type type) {
+  RST_DCHECK(!stack_.empty());
+  RST_DCHECK(stack_.back().type == type);
+  auto container = std::move(stack_.back());
+  stack_.pop_back();
+  if (type == Value::Type::kArray)
+    return Add(Value(std::move(container.array)));
+
+  return Add(Value(Value::Object(std::move(container.members))));
+}
+
+}  // namespace rst
@@ -0,0 +1,224 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_JSON_STREAM_PARSER_H_
+#define RST_VALUE_JSON_STREAM_PARSER_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/value/json_reader.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Receives the events of `rst::JsonStreamParser`. An error returned by a
+// method stops the parsing and is returned by the parser. String views are
+// valid only during the call.
+class JsonHandler {
+ public:
+  virtual ~JsonHandler();
+
+  virtual Status OnNull() = 0;
+  virtual Status OnBool(bool value) = 0;
+  // |number| has the `kNumber` type.
+  virtual Status OnNumber(const Value& number) = 0;
+  virtual Status OnString(std::string_view value) = 0;
+  virtual Status OnStartArray() = 0;
+  virtual Status OnEndArray() = 0;
+  virtual Status OnStartObject() = 0;
+  virtual Status OnKey(std::string_view key) = 0;
+  virtual Status OnEndObject() = 0;
+};
+
+// Event-driven JSON parser that accepts its input in chunks, e.g. from a pipe
+// or a socket buffer. Tokens can span chunks. The input is a sequence of
+// whitespace separated JSON values, so NDJSON is parsed as is. Calls the
+// handler for every token, the handler returns to the root level after each
+// value of the sequence.
+//
+// Strings without escapes are passed as views into the chunk. Strings with
+// escapes and tokens spanning chunks are collected in buffers that are reused,
+// so the parser doesn't allocate per scalar. Errors are `rst::JsonParseError`
+// with the offset in the whole input. The parser can't be used after an
+// error.
+//
+// Example:
+//
+//   #include "rst/value/json_stream_parser.h"
+//
+//   class Counter : public rst::JsonHandler {
+//    public:
+//     rst::Status OnNumber(const rst::Value&) override {
+//       count_++;
+//       return rst::Status::OK();
+//     }
+//     ...
+//   };
+//
+//   Counter counter;
+//   rst::JsonStreamParser parser(&counter);
+//   while (...)
+//     RST_TRY(parser.Parse(ReadChunk()));
+//   RST_TRY(parser.Finish());
+//
+class JsonStreamParser {
+ public:
+  explicit JsonStreamParser(NotNull<JsonHandler*> handler,
+                            JsonMaxDepth max_depth = JsonMaxDepth(200));
+  ~JsonStreamParser();
+
+  // Parses the next |chunk| of the input.
+  Status Parse(std::string_view chunk);
+  // Signals the end of the input. Returns an error if the input ends inside of
+  // a value or has no values.
+  Status Finish();
+
+ private:
+  // What is expected next outside of tokens.
+  enum class State {
+    kValue,
+    kFirstValueOrEnd,
+    kKey,
+    kFirstKeyOrEnd,
+    kColon,
+    kAfterValue,
+  };
+
+  // A string, a key, or a number or a literal that spans chunks.
+  enum class Token {
+    kNone,
+    kString,
+    kKey,
+    kScalar,
+  };
+
+  Status Fail(std::string_view message, size_t offset) const;
+  size_t GetOffset(const char* position) const;
+
+  // Scans a token that starts at |*current|. Processes it if it ends within
+  // the chunk, otherwise stores it as pending.
+  Status StartToken(Token token, NotNull<const char**> current,
+                    const char* end);
+  // Returns the position after the end of a string or a scalar that contains
+  // |begin| or nullptr if it doesn't end before |end|.
+  const char* ScanString(const char* begin, const char* end);
+  static const char* ScanScalar(const char* begin, const char* end);
+
+  Status ProcessToken(Token token, std::string_view raw, size_t offset);
+  Status ProcessScalar(std::string_view raw, size_t offset);
+  // Stores the contents of a quoted string in |string| unescaping it to
+  // |string_buffer_| if needed.
+  Status DecodeString(std::string_view raw, size_t offset,
+                      NotNull<std::string_view*> string);
+
+  Status Open(Value::Type type, size_t offset);
+  Status Close();
+
+  const NotNull<JsonHandler*> handler_;
+  const size_t max_depth_;
+
+  State state_ = State::kValue;
+  // Whether whitespace follows the last root value, possibly in a previous
+  // chunk.
+  bool is_root_value_separated_ = false;
+  // Types of the open arrays and objects.
+  std::vector<Value::Type> stack_;
+
+  // Offset of the current chunk in the input.
+  size_t chunk_offset_ = 0;
+  const char* chunk_begin_ = nullptr;
+
+  Token token_ = Token::kNone;
+  // Offset of the pending token in the input.
+  size_t token_offset_ = 0;
+  // Whether the pending string ends with a backslash.
+  bool is_escaped_ = false;
+  std::string token_buffer_;
+  std::string string_buffer_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonStreamParser);
+};
+
+// `rst::JsonHandler` that builds a `rst::Value` from the events of a single
+// value, e.g. of a subtree selected by another handler that forwards its
+// events.
+class JsonValueBuilder final : public JsonHandler {
+ public:
+  JsonValueBuilder();
+  ~JsonValueBuilder() override;
+
+  // Returns true if a whole value has been received.
+  bool HasValue() const { return has_value_; }
+  // Returns the value and resets the builder. Asserts that HasValue() is true.
+  Value TakeValue();
+
+  // JsonHandler:
+  Status OnNull() override;
+  Status OnBool(bool value) override;
+  Status OnNumber(const Value& number) override;
+  Status OnString(std::string_view value) override;
+  Status OnStartArray() override;
+  Status OnEndArray() override;
+  Status OnStartObject() override;
+  Status OnKey(std::string_view key) override;
+  Status OnEndObject() override;
+
+ private:
+  // An array or an object being built.
+  struct Container {
+    explicit Container(Value::Type type);
+    ~Container();
+
+    Container(Container&&) noexcept;
+    Container& operator=(Container&&) noexcept;
+
+    Value::Type type;
+    Value::Array array;
+    // Collects the members unsorted and sorts them once in the end.
+    Value::Object::container_type members;
+    Value::String key;
+  };
+
+  Status Add(Value&& value);
+  Status Close(Value::Type type);
+
+  std::vector<Container> stack_;
+  Value value_;
+  bool has_value_ = false;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonValueBuilder);
+};
+
+}  // namespace rst
+
+#endif  // RST_VALUE_JSON_STREAM_PARSER_H_
@@ -0,0 +1,198 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_stream_parser.h"
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/strings/str_cat.h"
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+// Records the events as a string.
+class RecordingHandler : public JsonHandler {
+ public:
+  Status OnNull() override { return Record("null"); }
+  Status OnBool(const bool value) override {
+    return Record(value ? "true" : "false");
+  }
+  Status OnNumber(const Value& number) override {
+    return Record(number.IsInt64() ? StrCat({"int:", number.GetInt64()})
+                                   : StrCat({"double:", number.GetDouble()}));
+  }
+  Status OnString(const std::string_view value) override {
+    return Record(StrCat({"'", value, "'"}));
+  }
+  Status OnStartArray() override { return Record("["); }
+  Status OnEndArray() override { return Record("]"); }
+  Status OnStartObject() override { return Record("{"); }
+  Status OnKey(const std::string_view key) override {
+    return Record(StrCat({key, ":"}));
+  }
+  Status OnEndObject() override { return Record("}"); }
+
+  const std::string& events() const { return events_; }
+
+ private:
+  Status Record(const std::string_view event) {
+    if (!events_.empty())
+      events_ += ' ';
+    events_ += event;
+    return Status::OK();
+  }
+
+  std::string events_;
+};
+
+// Parses |json| split into chunks of |chunk_size| bytes.
+std::string Parse(const std::string_view json, const size_t chunk_size) {
+  RecordingHandler handler;
+  JsonStreamParser parser(&handler);
+  for (size_t i = 0; i < json.size(); i += chunk_size) {
+    auto status = parser.Parse(json.substr(i, chunk_size));
+    RST_CHECK(!status.err());
+  }
+
+  auto status = parser.Finish();
+  RST_CHECK(!status.err());
+  return handler.events();
+}
+
+size_t ErrorOffset(const std::string_view json, const size_t chunk_size,
+                   const JsonMaxDepth max_depth = JsonMaxDepth(200)) {
+  RecordingHandler handler;
+  JsonStreamParser parser(&handler, max_depth);
+  for (size_t i = 0; i < json.size(); i += chunk_size) {
+    auto status = parser.Parse(json.substr(i, chunk_size));
+    if (status.err())
+      return GetErrorOffset<JsonParseError>(std::move(status));
+  }
+
+  return GetErrorOffset<JsonParseError>(parser.Finish());
+}
+
+constexpr std::string_view kJson =
+    R"({"a": [1, -2.5, true, false, null], "bA": "x\ny", )"
+    R"("c": {}, "d": [[]], "e": "😀"})";
+constexpr std::string_view kEvents =
+    "{ a: [ int:1 double:-2.5 true false null ] bA: 'x\ny' c: { } d: [ [ ] "
+    "] e: '\xf0\x9f\x98\x80' }";
+
+}  // namespace
+
+TEST(JsonStreamParser, Events) {
+  EXPECT_EQ(Parse(kJson, kJson.size()), kEvents);
+}
+
+TEST(JsonStreamParser, Chunks) {
+  for (size_t chunk_size = 1; chunk_size < kJson.size(); chunk_size++)
+    EXPECT_EQ(Parse(kJson, chunk_size), kEvents) << chunk_size;
+}
+
+TEST(JsonStreamParser, Scalars) {
+  EXPECT_EQ(Parse("123", 1), "int:123");
+  EXPECT_EQ(Parse(" true ", 2), "true");
+  EXPECT_EQ(Parse(R"("\\")", 2), "'\\'");
+  EXPECT_EQ(Parse(R"("\"")", 2), "'\"'");
+}
+
+TEST(JsonStreamParser, Sequence) {
+  constexpr std::string_view kNdjson = "{\"a\": 1}\n{\"a\": 2}\n3 \"4\"\n";
+  for (size_t chunk_size = 1; chunk_size <= kNdjson.size(); chunk_size++) {
+    EXPECT_EQ(Parse(kNdjson, chunk_size),
+              "{ a: int:1 } { a: int:2 } int:3 '4'")
+        << chunk_size;
+  }
+}
+
+TEST(JsonStreamParser, Errors) {
+  for (size_t chunk_size = 1; chunk_size <= 8; chunk_size++) {
+    EXPECT_EQ(ErrorOffset("", chunk_size), 0U);
+    EXPECT_EQ(ErrorOffset("[1, 2", chunk_size), 5U);
+    EXPECT_EQ(ErrorOffset("[1 2]", chunk_size), 3U);
+    EXPECT_EQ(ErrorOffset("[1, ]", chunk_size), 4U);
+    EXPECT_EQ(ErrorOffset("{1: 2}", chunk_size), 1U);
+    EXPECT_EQ(ErrorOffset(R"({"a" 2})", chunk_size), 5U);
+    EXPECT_EQ(ErrorOffset(R"({"a": 1])", chunk_size), 7U);
+    EXPECT_EQ(ErrorOffset(R"(["abc)", chunk_size), 5U);
+    EXPECT_EQ(ErrorOffset(R"(["a\x"])", chunk_size), 4U);
+    EXPECT_EQ(ErrorOffset("[\"a\x01\"]", chunk_size), 3U);
+    EXPECT_EQ(ErrorOffset("[tru]", chunk_size), 1U);
+    EXPECT_EQ(ErrorOffset("[truex]", chunk_size), 5U);
+    EXPECT_EQ(ErrorOffset("[-]", chunk_size), 2U);
+    EXPECT_EQ(ErrorOffset("[[[]]]", chunk_size, JsonMaxDepth(2)), 2U);
+    EXPECT_EQ(ErrorOffset(R"("a""b")", chunk_size), 3U);
+    EXPECT_EQ(ErrorOffset(R"(1"x")", chunk_size), 1U);
+    EXPECT_EQ(ErrorOffset("[1][2]", chunk_size), 3U);
+    EXPECT_EQ(ErrorOffset("{}1", chunk_size), 2U);
+    EXPECT_EQ(ErrorOffset("[1, 2][3]", chunk_size), 6U);
+    EXPECT_EQ(ErrorOffset("truefalse", chunk_size), 4U);
+  }
+}
+
+TEST(JsonStreamParser, HandlerError) {
+  class FailingHandler : public RecordingHandler {
+   public:
+    Status OnBool(bool) override {
+      return MakeStatus<JsonParseError>("Handler", 0);
+    }
+  };
+
+  FailingHandler handler;
+  JsonStreamParser parser(&handler);
+  auto status = parser.Parse("[1, true]");
+  ASSERT_TRUE(status.err());
+  EXPECT_EQ(status.GetError()->AsString(), "Handler at offset 0");
+  EXPECT_EQ(handler.events(), "[ int:1");
+}
+
+TEST(JsonValueBuilder, Build) {
+  for (size_t chunk_size = 1; chunk_size <= kJson.size(); chunk_size++) {
+    JsonValueBuilder builder;
+    JsonStreamParser parser(&builder);
+    for (size_t i = 0; i < kJson.size(); i += chunk_size) {
+      auto status = parser.Parse(kJson.substr(i, chunk_size));
+      ASSERT_FALSE(status.err());
+    }
+    auto status = parser.Finish();
+    ASSERT_FALSE(status.err());
+
+    ASSERT_TRUE(builder.HasValue());
+    auto expected = ParseJson(kJson);
+    ASSERT_FALSE(expected.err());
+    EXPECT_EQ(builder.TakeValue(), *expected);
+    EXPECT_FALSE(builder.HasValue());
+  }
+}
+
+}  // namespace rst
@@ -0,0 +1,284 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_writer.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+
+#include "rst/check/check.h"
+#include "rst/files/file_utils.h"
+#include "rst/macros/macros.h"
+#include "rst/value/json_scanner.h"
+
+namespace rst {
+namespace {
+
+// Size of the buffer that is flushed to a file.
+constexpr size_t kFileChunkSize = 64 * 1024;
+
+constexpr std::string_view kHexDigits = "0123456789abcdef";
+
+class JsonWriter {
+ public:
+  // If |file| is not null, |out| is used as a buffer flushed to |file|.
+  JsonWriter(const NotNull<std::string*> out, const Nullable<std::FILE*> file,
+             const bool pretty_print)
+      : out_(out), file_(file), pretty_print_(pretty_print) {}
+
+  void Write(const Value& value, const size_t depth) {
+    switch (value.type()) {
+      case Value::Type::kNull:
+        *out_ += "null";
+        return;
+      case Value::Type::kBool:
+        *out_ += value.GetBool() ? std::string_view("true")
+                                 : std::string_view("false");
+        return;
+      case Value::Type::kNumber:
+        if (value.IsInt64())
+          WriteInteger(value.GetInt64());
+        else
+          WriteNumber(value.GetDouble());
+        return;
+      case Value::Type::kString:
+        WriteString(value.GetString());
+        MaybeFlush();
+        return;
+      case Value::Type::kArray:
+        WriteArray(value.GetArray(), depth);
+        return;
+      case Value::Type::kObject:
+        WriteObject(value.GetObject(), depth);
+        return;
+    }
+
+    RST_NOTREACHED();
+  }
+
+  // Writes the buffered data to the file. Returns false on error.
+  bool Flush() {
+    RST_DCHECK(file_ != nullptr);
+    if (!out_->empty() &&
+        std::fwrite(out_->data(), 1, out_->size(), file_.get()) !=
+            out_->size()) {
+      has_error_ = true;
+    }
+
+    out_->clear();
+    return !has_error_;
+  }
+
+ private:
+  void MaybeFlush() {
+    if (file_ != nullptr && out_->size() >= kFileChunkSize)
+      (void)Flush();
+  }
+
+  void WriteNewLine(const size_t depth) {
+    if (!pretty_print_)
+      return;
+
+    *out_ += '\n';
+    out_->append(depth * 2, ' ');
+  }
+
+  void WriteInteger(const int64_t number) {
+    internal::WriteJsonInteger(number, out_);
+  }
+
+  void WriteNumber(const double number) {
+    internal::WriteJsonNumber(number, out_);
+  }
+
+  void WriteString(const std::string_view string) {
+    internal::WriteJsonString(string, out_);
+  }
+
+  void WriteArray(const Value::Array& array, const size_t depth) {
+    if (array.empty()) {
+      *out_ += "[]";
+      return;
+    }
+
+    *out_ += '[';
+    auto is_first = true;
+    for (const auto& element : array) {
+      if (!is_first)
+        *out_ += ',';
+      is_first = false;
+
+      WriteNewLine(depth + 1);
+      Write(element, depth + 1);
+      MaybeFlush();
+    }
+
+    WriteNewLine(depth);
+    *out_ += ']';
+  }
+
+  void WriteObject(const Value::Object& object, const size_t depth) {
+    if (object.empty()) {
+      *out_ += "{}";
+      return;
+    }
+
+    *out_ += '{';
+    auto is_first = true;
+    for (const auto& [key, value] : object) {
+      if (!is_first)
+        *out_ += ',';
+      is_first = false;
+
+      WriteNewLine(depth + 1);
+      WriteString(key);
+      *out_ += pretty_print_ ? std::string_view(": ") : std::string_view(":");
+      Write(value, depth + 1);
+      MaybeFlush();
+    }
+
+    WriteNewLine(depth);
+    *out_ += '}';
+  }
+
+  const NotNull<std::string*> out_;
+  const Nullable<std::FILE*> file_;
+  const bool pretty_print_;
+  bool has_error_ = false;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonWriter);
+};
+
+}  // namespace
+
+namespace internal {
+
+void WriteJsonInteger(const int64_t number, const NotNull<std::string*> out) {
+  // Enough for -2^63.
+  char buffer[24];
+  const auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), number);
+  RST_DCHECK(ec == std::errc());
+  out->append(buffer, ptr);
+}
+
+void WriteJsonNumber(const double number, const NotNull<std::string*> out) {
+  RST_DCHECK(std::isfinite(number) &&
+             "Non-finite (i.e. NaN or positive/negative infinity) values "
+             "cannot be represented in JSON");
+  // Enough for the longest shortest representation of a double, e.g.
+  // -2.2250738585072014e-308.
+  char buffer[32];
+  const auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), number);
+  RST_DCHECK(ec == std::errc());
+  out->append(buffer, ptr);
+}
+
+void WriteJsonNumber(const float number, const NotNull<std::string*> out) {
+  RST_DCHECK(std::isfinite(number) &&
+             "Non-finite (i.e. NaN or positive/negative infinity) values "
+             "cannot be represented in JSON");
+  // Enough for the longest shortest representation of a float, e.g.
+  // -1.1754944e-38.
+  char buffer[16];
+  const auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), number);
+  RST_DCHECK(ec == std::errc());
+  out->append(buffer, ptr);
+}
+
+void WriteJsonString(const std::string_view string,
+                     const NotNull<std::string*> out) {
+  *out += '"';
+
+  auto begin = string.data();
+  const auto end = begin + string.size();
+  while (true) {
+    const auto special = FindJsonStringSpecialChar(begin, end);
+    out->append(begin, special);
+    if (special == end)
+      break;
+
+    switch (*special) {
+      case '"':
+        *out += "\\\"";
+        break;
+      case '\\':
+        *out += "\\\\";
+        break;
+      case '\b':
+        *out += "\\b";
+        break;
+      case '\f':
+        *out += "\\f";
+        break;
+      case '\n':
+        *out += "\\n";
+        break;
+      case '\r':
+        *out += "\\r";
+        break;
+      case '\t':
+        *out += "\\t";
+        break;
+      default: {
+        const auto c = static_cast<unsigned char>(*special);
+        *out += "\\u00";
+        *out += kHexDigits[c >> 4];
+        *out += kHexDigits[c & 0xf];
+        break;
+      }
+    }
+
+    begin = special + 1;
+  }
+
+  *out += '"';
+}
+
+}  // namespace internal
+
+void WriteJson(const Value& value, const NotNull<std::string*> out,
+               const JsonPrettyPrint pretty_print) {
+  JsonWriter writer(out, nullptr, pretty_print.value());
+  writer.Write(value, 0);
+}
+
+Status WriteJsonToFile(const Value& value, const NotNull<std::FILE*> file,
+                       const JsonPrettyPrint pretty_print) {
+  std::string buffer;
+  buffer.reserve(kFileChunkSize * 2);
+  JsonWriter writer(&buffer, file.get(), pretty_print.value());
+  writer.Write(value, 0);
+  if (!writer.Flush())
+    return MakeStatus<FileError>("Can't write JSON to file");
+
+  return Status::OK();
+}
+
+}  // namespace rst
@@ -0,0 +1,92 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_JSON_WRITER_H_
+#define RST_VALUE_JSON_WRITER_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/type/type.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// If set, JSON is written with newlines and two spaces indentation.
+using JsonPrettyPrint = Type<class JsonPrettyPrintTag, bool>;
+
+// Appends the JSON representation of |value| to |out|. Numbers are written in
+// the shortest form that parses back to the same double, strings are written as
+// UTF-8 with quotes, backslashes and control characters escaped.
+//
+// Example:
+//
+//   #include "rst/value/json_writer.h"
+//
+//   rst::Value::Object object;
+//   object.emplace("key", 0.1);
+//   std::string json;
+//   rst::WriteJson(rst::Value(std::move(object)), &json);
+//   // json == R"({"key":0.1})"
+//
+void WriteJson(const Value& value, NotNull<std::string*> out,
+               JsonPrettyPrint pretty_print = JsonPrettyPrint(false));
+
+// Like `rst::WriteJson()` but streams the JSON to |file| in 64 KiB chunks, so
+// large values are written without materializing the whole text. Returns
+// `rst::FileError` on write error.
+//
+// Example:
+//
+//   #include "rst/value/json_writer.h"
+//
+//   const rst::Value& value = ...;
+//   rst::Status status =
+//       rst::WriteJsonToFile(value, stdout, rst::JsonPrettyPrint(true));
+//
+Status WriteJsonToFile(const Value& value, NotNull<std::FILE*> file,
+                       JsonPrettyPrint pretty_print = JsonPrettyPrint(false));
+
+namespace internal {
+
+// Appends the JSON representation of a number or a string to |out| like
+// `rst::WriteJson()` does.
+void WriteJsonInteger(int64_t number, NotNull<std::string*> out);
+void WriteJsonNumber(double number, NotNull<std::string*> out);
+// Writes the shortest representation that parses back to the same float.
+void WriteJsonNumber(float number, NotNull<std::string*> out);
+void WriteJsonString(std::string_view string, NotNull<std::string*> out);
+
+}  // namespace internal
+
+}  // namespace rst
+
+#endif  // RST_VALUE_JSON_WRITER_H_
@@ -0,0 +1,161 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/json_writer.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/check/check.h"
+#include "rst/value/json_reader.h"
+
+namespace rst {
+namespace {
+
+std::string Write(const Value& value,
+                  const JsonPrettyPrint pretty_print = JsonPrettyPrint(false)) {
+  std::string json;
+  WriteJson(value, &json, pretty_print);
+  return json;
+}
+
+Value MakeObject() {
+  Value::Array array;
+  array.emplace_back(1);
+  array.emplace_back(Value::Type::kObject);
+  array.emplace_back(Value::Type::kArray);
+
+  Value::Object nested;
+  nested.emplace("array", std::move(array));
+
+  Value::Object object;
+  object.emplace("b", std::move(nested));
+  object.emplace("a", true);
+  return Value(std::move(object));
+}
+
+}  // namespace
+
+TEST(JsonWriter, Literals) {
+  EXPECT_EQ(Write(Value()), "null");
+  EXPECT_EQ(Write(Value(true)), "true");
+  EXPECT_EQ(Write(Value(false)), "false");
+}
+
+TEST(JsonWriter, Numbers) {
+  EXPECT_EQ(Write(Value(0)), "0");
+  EXPECT_EQ(Write(Value(-123)), "-123");
+  EXPECT_EQ(Write(Value(9007199254740991)), "9007199254740991");
+  EXPECT_EQ(Write(Value(0.1)), "0.1");
+  EXPECT_EQ(Write(Value(1.5)), "1.5");
+  EXPECT_EQ(Write(Value(1e21)), "1e+21");
+  EXPECT_EQ(Write(Value(5e-324)), "5e-324");
+  EXPECT_EQ(Write(Value(1.7976931348623157e308)), "1.7976931348623157e+308");
+}
+
+TEST(JsonWriter, NumbersRoundTrip) {
+  std::mt19937_64 generator;
+  std::uniform_real_distribution<double> distribution(-1e10, 1e10);
+  for (auto i = 0; i < 10000; i++) {
+    const auto number = distribution(generator);
+    auto value = ParseJson(Write(Value(number)));
+    ASSERT_FALSE(value.err());
+    EXPECT_EQ(value->GetDouble(), number);
+  }
+}
+
+TEST(JsonWriter, Strings) {
+  EXPECT_EQ(Write(Value("")), R"("")");
+  EXPECT_EQ(Write(Value("foobar")), R"("foobar")");
+  EXPECT_EQ(Write(Value("a\"b\\c/d\be\ff\ng\rh\ti")),
+            R"("a\"b\\c/d\be\ff\ng\rh\ti")");
+  EXPECT_EQ(Write(Value(std::string("\x00\x01\x1f", 3))),
+            R"("\u0000\u0001\u001f")");
+  EXPECT_EQ(Write(Value("\xc3\xa9\xe2\x82\xac")), "\"\xc3\xa9\xe2\x82\xac\"");
+
+  for (auto i = 0; i < 40; i++) {
+    const std::string prefix(static_cast<size_t>(i), 'a');
+    EXPECT_EQ(Write(Value(prefix + "\n" + prefix)),
+              "\"" + prefix + "\\n" + prefix + "\"");
+  }
+}
+
+TEST(JsonWriter, Compact) {
+  EXPECT_EQ(Write(Value(Value::Type::kArray)), "[]");
+  EXPECT_EQ(Write(Value(Value::Type::kObject)), "{}");
+  EXPECT_EQ(Write(MakeObject()), R"({"a":true,"b":{"array":[1,{},[]]}})");
+}
+
+TEST(JsonWriter, PrettyPrint) {
+  EXPECT_EQ(Write(Value(Value::Type::kArray), JsonPrettyPrint(true)), "[]");
+  EXPECT_EQ(Write(MakeObject(), JsonPrettyPrint(true)),
+            "{\n"
+            "  \"a\": true,\n"
+            "  \"b\": {\n"
+            "    \"array\": [\n"
+            "      1,\n"
+            "      {},\n"
+            "      []\n"
+            "    ]\n"
+            "  }\n"
+            "}");
+}
+
+TEST(JsonWriter, RoundTrip) {
+  const auto value = MakeObject();
+  for (const auto pretty_print : {false, true}) {
+    auto parsed = ParseJson(Write(value, JsonPrettyPrint(pretty_print)));
+    ASSERT_FALSE(parsed.err());
+    EXPECT_EQ(*parsed, value);
+  }
+}
+
+TEST(JsonWriter, File) {
+  Value::Array array;
+  for (auto i = 0; i < 100000; i++)
+    array.emplace_back(std::to_string(i));
+  const Value value(std::move(array));
+
+  const auto file = std::tmpfile();
+  RST_CHECK(file != nullptr);
+  auto status = WriteJsonToFile(value, file);
+  ASSERT_FALSE(status.err());
+
+  std::string content(static_cast<size_t>(std::ftell(file)), '\0');
+  std::rewind(file);
+  ASSERT_EQ(std::fread(content.data(), 1, content.size(), file),
+            content.size());
+  (void)std::fclose(file);
+
+  EXPECT_EQ(content, Write(value));
+}
+
+}  // namespace rst
@@ -0,0 +1,174 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/ndjson_reader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "rst/check/check.h"
+#include "rst/task_runner/pipeline.h"
+#include "rst/value/value_arena.h"
+
+namespace rst {
+namespace {
+
+// Lines of |ndjson| that start at byte |offset| of the whole input.
+struct Chunk {
+  std::string_view ndjson;
+  size_t offset = 0;
+};
+
+// Records of a chunk allocated from the arena of the chunk.
+struct ParsedChunk {
+  std::unique_ptr<ValueArena> arena;
+  std::vector<NotNull<Value*>> values;
+  // The error after the last parsed record, if any.
+  std::optional<Status> status;
+};
+
+bool IsBlank(const char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+size_t SkipBlanks(const std::string_view line, size_t offset) {
+  while (offset < line.size() && IsBlank(line[offset]))
+    offset++;
+  return offset;
+}
+
+ParsedChunk ParseChunk(const Chunk& chunk, const JsonMaxDepth max_depth) {
+  ParsedChunk parsed;
+  parsed.arena = std::make_unique<ValueArena>();
+
+  const auto ndjson = chunk.ndjson;
+  for (size_t line_offset = 0; line_offset < ndjson.size();) {
+    auto line_end = ndjson.find('\n', line_offset);
+    if (line_end == std::string_view::npos)
+      line_end = ndjson.size();
+    const auto line = ndjson.substr(line_offset, line_end - line_offset);
+    const auto base_offset = chunk.offset + line_offset;
+    line_offset = line_end + 1;
+
+    const auto begin = SkipBlanks(line, 0);
+    if (begin == line.size())
+      continue;
+
+    const auto value = parsed.arena->New();
+    size_t end = 0;
+    auto status =
+        internal::ParseJsonValue(line, begin, base_offset, max_depth, value,
+                                 &end, parsed.arena->allocator());
+    if (status.err()) {
+      parsed.status = std::move(status);
+      break;
+    }
+
+    end = SkipBlanks(line, end);
+    if (end != line.size()) {
+      parsed.status =
+          MakeStatus<JsonParseError>("Expected end of line", base_offset + end);
+      break;
+    }
+
+    parsed.values.emplace_back(value);
+  }
+
+  return parsed;
+}
+
+}  // namespace
+
+Status ReadNdjson(const std::string_view ndjson,
+                  const NotNull<TaskRunner*> task_runner,
+                  const NdjsonParallelism parallelism,
+                  std::function<Status(const Value&)>&& callback,
+                  const NdjsonOrdered ordered,
+                  const NdjsonChunkSize chunk_size,
+                  const JsonMaxDepth max_depth) {
+  RST_DCHECK(parallelism.value() > 0);
+  RST_DCHECK(callback != nullptr);
+  RST_DCHECK(chunk_size.value() > 0);
+
+  // Only the sink, which runs one task at a time, sets |error|. It is read
+  // after the pipeline is idle.
+  std::optional<Status> error;
+  std::atomic<bool> failed = false;
+
+  const auto pipeline =
+      PipelineBuilder<Chunk>(task_runner, 2 * parallelism.value())
+          .AddStage<ParsedChunk>(
+              [&failed, max_depth](Chunk&& chunk) -> ParsedChunk {
+                if (failed.load(std::memory_order_relaxed))
+                  return ParsedChunk();
+                return ParseChunk(chunk, max_depth);
+              },
+              PipelineParallelism(parallelism.value()),
+              PipelineOrdered(ordered.value()))
+          .Build(
+              [&error, &failed, &callback](ParsedChunk&& chunk) {
+                if (failed.load(std::memory_order_relaxed)) {
+                  if (chunk.status.has_value())
+                    chunk.status->Ignore();
+                  return;
+                }
+
+                for (const auto& value : chunk.values) {
+                  auto status = callback(*value);
+                  if (status.err()) {
+                    error = std::move(status);
+                    failed.store(true, std::memory_order_relaxed);
+                    if (chunk.status.has_value())
+                      chunk.status->Ignore();
+                    return;
+                  }
+                }
+
+                if (chunk.status.has_value()) {
+                  error = std::move(*chunk.status);
+                  failed.store(true, std::memory_order_relaxed);
+                }
+              },
+              PipelineParallelism(1), PipelineOrdered(ordered.value()));
+
+  for (size_t offset = 0; offset < ndjson.size() &&
+                          !failed.load(std::memory_order_relaxed);) {
+    auto end = ndjson.find('\n', offset + chunk_size.value() - 1);
+    end = (end == std::string_view::npos) ? ndjson.size() : end + 1;
+    pipeline->Push(Chunk{ndjson.substr(offset, end - offset), offset});
+    offset = end;
+  }
+  pipeline->Wait();
+
+  if (error.has_value())
+    return std::move(*error);
+  return Status::OK();
+}
+
+}  // namespace rst
@@ -0,0 +1,89 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_NDJSON_READER_H_
+#define RST_VALUE_NDJSON_READER_H_
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/task_runner/task_runner.h"
+#include "rst/type/type.h"
+#include "rst/value/json_reader.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Maximum number of chunks parsed concurrently.
+using NdjsonParallelism = Type<class NdjsonParallelismTag, size_t>;
+// Whether the records are delivered in the order of the input.
+using NdjsonOrdered = Type<class NdjsonOrderedTag, bool>;
+// Minimum size of a chunk of records in bytes. The last chunk can be smaller.
+using NdjsonChunkSize = Type<class NdjsonChunkSizeTag, size_t>;
+
+// Parses newline-delimited JSON: one JSON value per line, blank lines are
+// skipped. |ndjson| is split at line boundaries into chunks of |chunk_size|
+// bytes that are parsed concurrently on |task_runner| by up to |parallelism|
+// tasks, each into its own `rst::ValueArena`, so the parsers don't contend on
+// an allocator. |callback| is called for every record, one call at a time, in
+// the input order if |ordered| is set or as soon as chunks are parsed
+// otherwise. The value is only valid during the call, `Clone()` it to keep
+// it. At most twice |parallelism| chunks are in memory at the same time, so a
+// large mapped file can be read with constant memory.
+//
+// Stops at the first error: a record that is not a single JSON value, which is
+// returned as `rst::JsonParseError` with the offset in |ndjson|, or an error
+// returned by |callback|. In the ordered mode all the records before the first
+// malformed one are delivered. Must not be called from a thread of
+// |task_runner|.
+//
+// Example:
+//
+//   #include "rst/value/ndjson_reader.h"
+//
+//   rst::ThreadPoolTaskRunner task_runner(...);
+//   std::string_view logs = ...;
+//   rst::Status status = rst::ReadNdjson(
+//       logs, &task_runner, rst::NdjsonParallelism(8),
+//       [](const rst::Value& record) -> rst::Status {
+//         Process(record);
+//         return rst::Status::OK();
+//       });
+//
+Status ReadNdjson(std::string_view ndjson, NotNull<TaskRunner*> task_runner,
+                  NdjsonParallelism parallelism,
+                  std::function<Status(const Value&)>&& callback,
+                  NdjsonOrdered ordered = NdjsonOrdered(true),
+                  NdjsonChunkSize chunk_size = NdjsonChunkSize(1 << 20),
+                  JsonMaxDepth max_depth = JsonMaxDepth(200));
+
+}  // namespace rst
+
+#endif  // RST_VALUE_NDJSON_READER_H_
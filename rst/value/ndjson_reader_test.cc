@@ -0,0 +1,158 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/ndjson_reader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rst/rtti/rtti.h"
+#include "rst/strings/str_cat.h"
+#include "rst/task_runner/thread_pool_task_runner.h"
+#include "rst/value/value_test_util.h"
+
+namespace chrono = std::chrono;
+
+namespace rst {
+namespace {
+
+std::string MakeRecords(const int count) {
+  std::string ndjson;
+  for (auto i = 0; i < count; i++)
+    ndjson += StrCat({R"({"id": )", i, R"(, "tags": ["a", "b"]})", "\n"});
+  return ndjson;
+}
+
+size_t ErrorOffset(const std::string_view ndjson) {
+  ThreadPoolTaskRunner task_runner(2, chrono::seconds(60));
+  auto status = ReadNdjson(
+      ndjson, &task_runner, NdjsonParallelism(2),
+      [](const Value&) -> Status { return Status::OK(); }, NdjsonOrdered(true),
+      NdjsonChunkSize(4));
+  return GetErrorOffset<JsonParseError>(std::move(status));
+}
+
+}  // namespace
+
+TEST(ReadNdjson, Ordered) {
+  ThreadPoolTaskRunner task_runner(4, chrono::seconds(60));
+  const auto ndjson = MakeRecords(1000);
+
+  std::vector<int64_t> ids;
+  auto status = ReadNdjson(
+      ndjson, &task_runner, NdjsonParallelism(4),
+      [&ids](const Value& record) -> Status {
+        const auto id = record.FindInt64Key("id");
+        RST_CHECK(id.has_value());
+        ids.emplace_back(*id);
+        return Status::OK();
+      },
+      NdjsonOrdered(true), NdjsonChunkSize(100));
+  ASSERT_FALSE(status.err());
+
+  ASSERT_EQ(ids.size(), 1000U);
+  for (size_t i = 0; i < ids.size(); i++)
+    EXPECT_EQ(ids[i], static_cast<int64_t>(i));
+}
+
+TEST(ReadNdjson, Unordered) {
+  ThreadPoolTaskRunner task_runner(4, chrono::seconds(60));
+  const auto ndjson = MakeRecords(1000);
+
+  std::vector<int64_t> ids;
+  auto status = ReadNdjson(
+      ndjson, &task_runner, NdjsonParallelism(4),
+      [&ids](const Value& record) -> Status {
+        const auto id = record.FindInt64Key("id");
+        RST_CHECK(id.has_value());
+        ids.emplace_back(*id);
+        return Status::OK();
+      },
+      NdjsonOrdered(false), NdjsonChunkSize(100));
+  ASSERT_FALSE(status.err());
+
+  std::sort(ids.begin(), ids.end());
+  ASSERT_EQ(ids.size(), 1000U);
+  for (size_t i = 0; i < ids.size(); i++)
+    EXPECT_EQ(ids[i], static_cast<int64_t>(i));
+}
+
+TEST(ReadNdjson, BlankLines) {
+  ThreadPoolTaskRunner task_runner(2, chrono::seconds(60));
+
+  std::vector<Value> records;
+  auto status = ReadNdjson(
+      "\n  1 \r\n\n[true]\n \t\n\"a\"", &task_runner, NdjsonParallelism(2),
+      [&records](const Value& record) -> Status {
+        records.emplace_back(record.Clone());
+        return Status::OK();
+      });
+  ASSERT_FALSE(status.err());
+
+  ASSERT_EQ(records.size(), 3U);
+  EXPECT_EQ(records[0], Value(1));
+  ASSERT_TRUE(records[1].IsArray());
+  EXPECT_EQ(records[1].GetArray().size(), 1U);
+  EXPECT_EQ(records[2], Value("a"));
+
+  status = ReadNdjson(
+      "", &task_runner, NdjsonParallelism(2),
+      [](const Value&) -> Status { return Status::OK(); });
+  EXPECT_FALSE(status.err());
+}
+
+TEST(ReadNdjson, Errors) {
+  EXPECT_EQ(ErrorOffset("1\n2\n[\n"), 5U);
+  EXPECT_EQ(ErrorOffset("1\n2 3\n"), 4U);
+  EXPECT_EQ(ErrorOffset("1\n{\"a\":\n1}\n"), 7U);
+}
+
+TEST(ReadNdjson, CallbackError) {
+  ThreadPoolTaskRunner task_runner(4, chrono::seconds(60));
+  const auto ndjson = MakeRecords(1000);
+
+  size_t count = 0;
+  auto status = ReadNdjson(
+      ndjson, &task_runner, NdjsonParallelism(4),
+      [&count](const Value&) -> Status {
+        if (++count == 10)
+          return MakeStatus<JsonParseError>("Callback", 0);
+        return Status::OK();
+      },
+      NdjsonOrdered(true), NdjsonChunkSize(100));
+  ASSERT_TRUE(status.err());
+  EXPECT_NE(dyn_cast<JsonParseError>(status.GetError()), nullptr);
+  EXPECT_EQ(count, 10U);
+}
+
+}  // namespace rst
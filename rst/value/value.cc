@@ -27,61 +27,112 @@
 
 #include "rst/value/value.h"
 
-#include "rst/clone/clone.h"
+#include "rst/stl/hash.h"
 
 namespace rst {
 
-Value::Value(const Type type) : type_(type) {
+static_assert(sizeof(Value) <= 16);
+
+Value::Path::Path(const std::string_view path) : path_(path) {
+  RST_DCHECK(!path.empty());
+  auto current_path = path;
+  for (auto delimiter_position = current_path.find('.');
+       delimiter_position != std::string_view::npos;
+       delimiter_position = current_path.find('.')) {
+    keys_.emplace_back(current_path.substr(0, delimiter_position));
+    current_path = current_path.substr(delimiter_position + 1);
+  }
+
+  keys_.emplace_back(current_path);
+}
+
+Value::Path::~Path() = default;
+
+Value::Path::Path(const Path&) = default;
+
+Value::Path::Path(Path&&) noexcept = default;
+
+Value::Path& Value::Path::operator=(const Path&) = default;
+
+Value::Path& Value::Path::operator=(Path&&) noexcept = default;
+
+Value::Value(std::allocator_arg_t, const allocator_type& allocator,
+             const Type type)
+    : type_(type) {
   switch (type_) {
     case Type::kNull:
       return;
     case Type::kBool:
-      get_bool() = false;
+      bool_ = false;
       return;
     case Type::kNumber:
-      get_number() = 0.0;
+      is_int64_ = true;
+      int64_ = 0;
       return;
     case Type::kString:
-      new (&string_) String();
+      string_ = NewNode<String>(allocator);
       return;
     case Type::kArray:
-      new (&array_) Array();
+      array_ = NewNode<Array>(allocator);
       return;
     case Type::kObject:
-      new (&object_) Object();
+      object_ = NewNode<Object>(allocator);
       return;
   }
 }
 
+Value::Value(std::allocator_arg_t, const allocator_type& allocator,
+             Value&& other) {
+  const auto resource = other.GetResource();
+  if (resource == nullptr || *resource == *allocator.resource())
+    MoveConstruct(std::move(other));
+  else
+    MoveConstruct(other.Clone(allocator));
+}
+
 Value::Value(Value&& other) noexcept { MoveConstruct(std::move(other)); }
 
 Value::~Value() { Cleanup(); }
 
 Value& Value::operator=(Value&& rhs) noexcept {
-  if (type_ == rhs.type_) {
-    MoveAssign(std::move(rhs));
-  } else {
-    Cleanup();
-    MoveConstruct(std::move(rhs));
-  }
-
+  // |rhs| can be owned by this value, so takes it before the cleanup.
+  Value value(std::move(rhs));
+  Cleanup();
+  MoveConstruct(std::move(value));
   return *this;
 }
 
-Value Value::Clone() const {
+Value Value::Clone(const allocator_type& allocator) const {
   switch (type_) {
     case Type::kNull:
       return Value();
     case Type::kBool:
       return Value(get_bool());
     case Type::kNumber:
-      return Value(get_number());
+      return is_int64_ ? Value(int64_) : Value(number_);
     case Type::kString:
-      return Value(rst::Clone(get_string()));
     case Type::kArray:
-      return Value(Clone(get_array()));
     case Type::kObject:
-      return Value(Clone(get_object()));
+      break;
+  }
+
+  const auto resource = GetResource();
+  RST_DCHECK(resource != nullptr);
+  if (*resource == *allocator.resource())
+    return Share();
+
+  switch (type_) {
+    case Type::kNull:
+    case Type::kBool:
+    case Type::kNumber:
+      break;
+    case Type::kString:
+      return Value(std::allocator_arg, allocator,
+                   std::string_view(get_string()));
+    case Type::kArray:
+      return Value(Clone(get_array(), allocator));
+    case Type::kObject:
+      return Value(Clone(get_object(), allocator));
   }
 
   RST_NOTREACHED();
@@ -89,22 +140,44 @@ Value Value::Clone() const {
 }
 
 // static
-Value::Array Value::Clone(const Array& array) {
-  Array result;
+Value::Array Value::Clone(const Array& array, const allocator_type& allocator) {
+  Array result(allocator);
   result.reserve(array.size());
   for (const auto& value : array)
-    result.emplace_back(value.Clone());
+    result.emplace_back(value.Clone(allocator));
   return result;
 }
 
 // static
-Value::Object Value::Clone(const Object& object) {
-  Object result;
+Value::Object Value::Clone(const Object& object,
+                           const allocator_type& allocator) {
+  Object result(allocator);
   for (const auto& [key, value] : object)
-    result.try_emplace(result.cend(), key, value.Clone());
+    result.try_emplace(result.cend(), key, value.Clone(allocator));
   return result;
 }
 
+bool Value::SharesStorageWith(const Value& other) const {
+  if (type_ != other.type_)
+    return false;
+
+  switch (type_) {
+    case Type::kNull:
+    case Type::kBool:
+    case Type::kNumber:
+      return false;
+    case Type::kString:
+      return string_ == other.string_;
+    case Type::kArray:
+      return array_ == other.array_;
+    case Type::kObject:
+      return object_ == other.object_;
+  }
+
+  RST_NOTREACHED();
+  return false;
+}
+
 Nullable<const Value*> Value::FindKey(const std::string_view key) const {
   RST_DCHECK(IsObject());
   const auto it = get_object().find(key);
@@ -113,6 +186,15 @@ Nullable<const Value*> Value::FindKey(const std::string_view key) const {
   return &it->second;
 }
 
+Nullable<Value*> Value::FindKey(const std::string_view key) {
+  RST_DCHECK(IsObject());
+  auto& object = get_object();
+  const auto it = object.find(key);
+  if (it == object.end())
+    return nullptr;
+  return &it->second;
+}
+
 Nullable<const Value*> Value::FindKeyOfType(const std::string_view key,
                                             const Type type) const {
   const auto result = FindKey(key);
@@ -125,6 +207,18 @@ Nullable<const Value*> Value::FindKeyOfType(const std::string_view key,
   return result;
 }
 
+Nullable<Value*> Value::FindKeyOfType(const std::string_view key,
+                                      const Type type) {
+  const auto result = FindKey(key);
+  if (result == nullptr)
+    return nullptr;
+
+  if (result->type_ != type)
+    return nullptr;
+
+  return result;
+}
+
 std::optional<bool> Value::FindBoolKey(const std::string_view key) const {
   const auto result = FindKeyOfType(key, Type::kBool);
   if (result == nullptr)
@@ -140,7 +234,7 @@ std::optional<int64_t> Value::FindInt64Key(const std::string_view key) const {
   if (!result->IsInt64())
     return std::nullopt;
 
-  return static_cast<int64_t>(result->get_number());
+  return result->get_int64();
 }
 
 std::optional<int> Value::FindIntKey(const std::string_view key) const {
@@ -151,7 +245,7 @@ std::optional<int> Value::FindIntKey(const std::string_view key) const {
   if (!result->IsInt())
     return std::nullopt;
 
-  return static_cast<int>(result->get_number());
+  return static_cast<int>(result->get_int64());
 }
 
 std::optional<double> Value::FindDoubleKey(const std::string_view key) const {
@@ -169,11 +263,18 @@ Nullable<const Value::String*> Value::FindStringKey(
   return &result->get_string();
 }
 
-NotNull<Value*> Value::SetKey(std::string&& key, Value&& value) {
+NotNull<Value*> Value::SetKey(const std::string_view key, Value&& value) {
   RST_DCHECK(IsObject());
-  const auto [it, _] =
-      get_object().insert_or_assign(std::move(key), std::move(value));
-  return &it->second;
+  auto& object = get_object();
+  const auto it = object.lower_bound(key);
+  if (it != object.end() && it->first == key) {
+    // Keeps the value within the memory resource of the object.
+    it->second = Value(std::allocator_arg, object.get_allocator(),
+                       std::move(value));
+    return &it->second;
+  }
+
+  return &object.emplace_hint(it, key, std::move(value))->second;
 }
 
 bool Value::RemoveKey(const std::string_view key) {
@@ -197,8 +298,7 @@ NotNull<Value*> Value::SetPath(const std::string_view path, Value&& value) {
     const auto key = current_path.substr(0, delimiter_position);
     auto child_object = current_object->FindKeyOfType(key, Type::kObject);
     if (child_object == nullptr) {
-      child_object =
-          current_object->SetKey(std::string(key), Value(Type::kObject));
+      child_object = current_object->SetKey(key, Value(Type::kObject));
     }
 
     RST_DCHECK(child_object != nullptr);
@@ -206,7 +306,7 @@ NotNull<Value*> Value::SetPath(const std::string_view path, Value&& value) {
     current_path = current_path.substr(delimiter_position + 1);
   }
 
-  return current_object->SetKey(std::string(current_path), std::move(value));
+  return current_object->SetKey(current_path, std::move(value));
 }
 
 Nullable<const Value*> Value::FindPath(const std::string_view path) const {
@@ -229,52 +329,257 @@ Nullable<const Value*> Value::FindPath(const std::string_view path) const {
   return current_object->FindKey(current_path);
 }
 
-void Value::MoveConstruct(Value&& other) {
-  type_ = other.type_;
+Nullable<Value*> Value::FindPath(const std::string_view path) {
+  RST_DCHECK(IsObject());
 
-  switch (other.type_) {
+  auto current_path = path;
+  NotNull<Value*> current_object = this;
+  for (auto delimiter_position = current_path.find('.');
+       delimiter_position != std::string_view::npos;
+       delimiter_position = current_path.find('.')) {
+    const auto key = current_path.substr(0, delimiter_position);
+    const auto child_object = current_object->FindKeyOfType(key, Type::kObject);
+    if (child_object == nullptr)
+      return nullptr;
+
+    current_object = child_object;
+    current_path = current_path.substr(delimiter_position + 1);
+  }
+
+  return current_object->FindKey(current_path);
+}
+
+NotNull<Value*> Value::SetPath(const Path& path, Value&& value) {
+  RST_DCHECK(IsObject());
+
+  const auto& keys = path.keys();
+  NotNull<Value*> current_object = this;
+  for (size_t i = 0; i + 1 < keys.size(); i++) {
+    auto child_object = current_object->FindKeyOfType(keys[i], Type::kObject);
+    if (child_object == nullptr)
+      child_object = current_object->SetKey(keys[i], Value(Type::kObject));
+
+    RST_DCHECK(child_object != nullptr);
+    current_object = child_object;
+  }
+
+  return current_object->SetKey(keys.back(), std::move(value));
+}
+
+Nullable<const Value*> Value::FindPath(const Path& path) const {
+  RST_DCHECK(IsObject());
+
+  const auto& keys = path.keys();
+  NotNull<const Value*> current_object = this;
+  for (size_t i = 0; i + 1 < keys.size(); i++) {
+    const auto child_object =
+        current_object->FindKeyOfType(keys[i], Type::kObject);
+    if (child_object == nullptr)
+      return nullptr;
+
+    current_object = child_object;
+  }
+
+  return current_object->FindKey(keys.back());
+}
+
+Nullable<Value*> Value::FindPath(const Path& path) {
+  RST_DCHECK(IsObject());
+
+  const auto& keys = path.keys();
+  NotNull<Value*> current_object = this;
+  for (size_t i = 0; i + 1 < keys.size(); i++) {
+    const auto child_object =
+        current_object->FindKeyOfType(keys[i], Type::kObject);
+    if (child_object == nullptr)
+      return nullptr;
+
+    current_object = child_object;
+  }
+
+  return current_object->FindKey(keys.back());
+}
+
+// static
+template <class T>
+void Value::Unshare(Node<T>*& node) {
+  if (node->ref_count.load(std::memory_order_acquire) == 1)
+    return;
+
+  const allocator_type allocator = node->value.get_allocator();
+  Node<T>* copy = nullptr;
+  if constexpr (std::is_same_v<T, String>)
+    copy = NewNode<String>(allocator, node->value);
+  else
+    copy = NewNode<T>(allocator, Clone(node->value, allocator));
+
+  DeleteNode(node);
+  node = copy;
+}
+
+Value Value::Share() const {
+  Value value;
+  value.type_ = type_;
+  switch (type_) {
     case Type::kNull:
-      break;
     case Type::kBool:
-      get_bool() = other.get_bool();
-      break;
     case Type::kNumber:
-      get_number() = other.get_number();
+      RST_NOTREACHED();
       break;
     case Type::kString:
-      new (&string_) String(std::move(other.get_string()));
+      string_->ref_count.fetch_add(1, std::memory_order_relaxed);
+      value.string_ = string_;
       break;
     case Type::kArray:
-      new (&array_) Array(std::move(other.get_array()));
+      array_->ref_count.fetch_add(1, std::memory_order_relaxed);
+      value.array_ = array_;
       break;
     case Type::kObject:
-      new (&object_) Object(std::move(other.get_object()));
+      object_->ref_count.fetch_add(1, std::memory_order_relaxed);
+      value.object_ = object_;
       break;
   }
+
+  return value;
+}
+
+Value::String& Value::get_string() {
+  Unshare(string_);
+  string_->hash.store(0, std::memory_order_relaxed);
+  return string_->value;
+}
+
+Value::Array& Value::get_array() {
+  Unshare(array_);
+  array_->hash.store(0, std::memory_order_relaxed);
+  return array_->value;
 }
 
-void Value::MoveAssign(Value&& rhs) {
-  RST_DCHECK(type_ == rhs.type_);
+Value::Object& Value::get_object() {
+  Unshare(object_);
+  object_->hash.store(0, std::memory_order_relaxed);
+  return object_->value;
+}
+
+size_t Value::Hash() const { return ComputeHash(false); }
+
+size_t Value::CachedHash() const {
+  const auto cache = GetHashCache();
+  if (cache == nullptr)
+    return ComputeHash(true);
 
-  switch (rhs.type_) {
+  auto hash = cache->load(std::memory_order_relaxed);
+  if (hash != 0)
+    return hash;
+
+  hash = ComputeHash(true);
+  if (hash == 0)
+    hash = 1;
+  cache->store(hash, std::memory_order_relaxed);
+  return hash;
+}
+
+Nullable<std::atomic<size_t>*> Value::GetHashCache() const {
+  switch (type_) {
     case Type::kNull:
-      return;
     case Type::kBool:
-      get_bool() = rhs.get_bool();
-      return;
     case Type::kNumber:
-      get_number() = rhs.get_number();
-      return;
+      return nullptr;
     case Type::kString:
-      get_string() = std::move(rhs.get_string());
-      return;
+      return &string_->hash;
     case Type::kArray:
-      get_array() = std::move(rhs.get_array());
-      return;
+      return &array_->hash;
     case Type::kObject:
-      get_object() = std::move(rhs.get_object());
-      return;
+      return &object_->hash;
+  }
+
+  RST_NOTREACHED();
+  return nullptr;
+}
+
+size_t Value::ComputeHash(const bool use_cache) const {
+  switch (type_) {
+    case Type::kNull:
+      return HashCombine({type_});
+    case Type::kBool:
+      return HashCombine({type_, get_bool()});
+    case Type::kNumber: {
+      // operator== treats numbers closer than epsilon as equal, which can only
+      // happen to distinct numbers in [-1, 1].
+      const auto number = get_number();
+      if (std::fabs(number) <= 1.0)
+        return HashCombine({type_});
+      return HashCombine({type_, number});
+    }
+    case Type::kString:
+      return HashCombine({type_, std::string_view(get_string())});
+    case Type::kArray: {
+      auto hash = HashCombine({type_, get_array().size()});
+      for (const auto& value : get_array())
+        hash = HashCombine(
+            {hash, use_cache ? value.CachedHash() : value.Hash()});
+      return hash;
+    }
+    case Type::kObject: {
+      auto hash = HashCombine({type_, get_object().size()});
+      for (const auto& [key, value] : get_object())
+        hash = HashCombine({hash, std::string_view(key),
+                            use_cache ? value.CachedHash() : value.Hash()});
+      return hash;
+    }
+  }
+
+  RST_NOTREACHED();
+  return 0;
+}
+
+Nullable<std::pmr::memory_resource*> Value::GetResource() const {
+  switch (type_) {
+    case Type::kNull:
+    case Type::kBool:
+    case Type::kNumber:
+      return nullptr;
+    case Type::kString:
+      return get_string().get_allocator().resource();
+    case Type::kArray:
+      return get_array().get_allocator().resource();
+    case Type::kObject:
+      return get_object().get_allocator().resource();
   }
+
+  RST_NOTREACHED();
+  return nullptr;
+}
+
+void Value::MoveConstruct(Value&& other) {
+  type_ = other.type_;
+  is_int64_ = other.is_int64_;
+
+  switch (other.type_) {
+    case Type::kNull:
+      break;
+    case Type::kBool:
+      bool_ = other.bool_;
+      break;
+    case Type::kNumber:
+      if (is_int64_)
+        int64_ = other.int64_;
+      else
+        number_ = other.number_;
+      break;
+    case Type::kString:
+      string_ = other.string_;
+      break;
+    case Type::kArray:
+      array_ = other.array_;
+      break;
+    case Type::kObject:
+      object_ = other.object_;
+      break;
+  }
+
+  other.type_ = Type::kNull;
+  other.is_int64_ = false;
 }
 
 void Value::Cleanup() {
@@ -284,13 +589,13 @@ void Value::Cleanup() {
     case Type::kNumber:
       return;
     case Type::kString:
-      get_string().~String();
+      DeleteNode(string_);
       return;
     case Type::kArray:
-      get_array().~Array();
+      DeleteNode(array_);
       return;
     case Type::kObject:
-      get_object().~Object();
+      DeleteNode(object_);
       return;
   }
 }
@@ -298,6 +603,17 @@ void Value::Cleanup() {
 bool operator==(const Value& lhs, const Value& rhs) {
   if (lhs.type_ != rhs.type_)
     return false;
+  if (lhs.SharesStorageWith(rhs))
+    return true;
+
+  const auto lhs_cache = lhs.GetHashCache();
+  const auto rhs_cache = rhs.GetHashCache();
+  if (lhs_cache != nullptr && rhs_cache != nullptr) {
+    const auto lhs_hash = lhs_cache->load(std::memory_order_relaxed);
+    const auto rhs_hash = rhs_cache->load(std::memory_order_relaxed);
+    if (lhs_hash != 0 && rhs_hash != 0 && lhs_hash != rhs_hash)
+      return false;
+  }
 
   switch (lhs.type_) {
     case Value::Type::kNull:
@@ -305,6 +621,8 @@ bool operator==(const Value& lhs, const Value& rhs) {
     case Value::Type::kBool:
       return lhs.get_bool() == rhs.get_bool();
     case Value::Type::kNumber:
+      if (lhs.is_int64_ && rhs.is_int64_)
+        return lhs.int64_ == rhs.int64_;
       return std::fabs(lhs.get_number() - rhs.get_number()) <
              std::numeric_limits<double>::epsilon();
     case Value::Type::kString:
@@ -332,6 +650,8 @@ bool operator<(const Value& lhs, const Value& rhs) {
              static_cast<int>(rhs.get_bool());
     }
     case Value::Type::kNumber: {
+      if (lhs.is_int64_ && rhs.is_int64_)
+        return lhs.int64_ < rhs.int64_;
       return lhs.get_number() < rhs.get_number();
     }
     case Value::Type::kString: {
@@ -28,24 +28,32 @@
 #ifndef RST_VALUE_VALUE_H_
 #define RST_VALUE_VALUE_H_
 
+#include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <limits>
-#include <map>
-#include <new>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "rst/check/check.h"
 #include "rst/macros/macros.h"
 #include "rst/not_null/not_null.h"
+#include "rst/stl/flat_map.h"
 
 namespace rst {
 
+namespace internal {
+class ValueMemoryUsageCalculator;
+}  // namespace internal
+
 // A Chromium-like JSON `Value` class.
 //
 // This is a recursive data storage class intended for storing settings and
@@ -55,23 +63,66 @@ namespace rst {
 // to/from JavaScript. As such, it is not a generalized variant type, since only
 // the types supported by JavaScript/JSON are supported.
 //
-// In particular this means that there is no support for `int64_t` or unsigned
-// numbers. Writing JSON with such types would violate the spec. If you need
-// something like this, either use a `double` or make a `string` value
-// containing the number you want.
+// In particular this means that there is no support for `int64_t` values
+// beyond 2^53 - 1 or unsigned numbers. Writing JSON with such types would
+// violate the spec. If you need something like this, either use a `double` or
+// make a `string` value containing the number you want.
 //
 // Construction:
 //
 // `rst::Value` is directly constructible from `bool`, `int32_t`, `int64_t`
 // (checking that the modulo of the value is <= 2^53 - 1, `double` (excluding
-// NaN and inf), `const char*`, `std::string`, `rst::Value::Array`, and
-// `rst::Value::Object`.
+// NaN and inf), `const char*`, `std::string_view`, `rst::Value::String`,
+// `rst::Value::Array`, and `rst::Value::Object`.
+//
+// Memory resources:
+//
+// `rst::Value` is allocator-aware: strings, arrays and objects are `std::pmr`
+// containers allocated from a `std::pmr::memory_resource`, the default one
+// unless another one is passed with `std::allocator_arg`. Arrays and objects
+// construct their elements with their own memory resource, so a tree stays
+// within one resource. See `rst::ValueArena` for arena-backed trees.
+//
+// Since `rst::Value::String` is `std::pmr::string`, it doesn't convert to
+// `std::string` implicitly: `std::string s = value.GetString();` doesn't
+// compile. Use `GetStdString()` or `std::string_view` instead. A `std::string`
+// passed to the constructor is copied through `std::string_view`.
+//
+// Storage:
+//
+// `rst::Value` is 16 bytes large: a type tag and a payload. Null, bools and
+// numbers are stored inline. Strings, arrays and objects are allocated on the
+// heap and the payload points to them, so they don't move when the
+// `rst::Value` is moved. Numbers constructed from integers are stored as
+// `int64_t` and read back by `GetInt64()` and `GetInt()` without going through
+// `double`. Both representations have the `kNumber` type and compare by their
+// numeric value.
 //
 // Copying:
 //
 // `rst::Value` does not support C++ copy semantics to make it harder to
 // accidentally copy large values. Instead, use `Clone()` to manually create a
-// deep copy.
+// copy. A moved-from `rst::Value` is null.
+//
+// Strings, arrays and objects are reference counted and copied on write, so
+// `Clone()` into the same memory resource only increments a counter. The first
+// mutation of a shared string, array or object through a non-const method,
+// e.g. `GetObject()`, `FindKey()` or `SetKey()`, copies it, sharing its
+// elements. So changing a value deep inside of a clone copies only the path to
+// it. References and pointers obtained from non-const methods must not be
+// used to modify the value after it has been cloned. Clones can be used from
+// different threads.
+//
+// Hashing:
+//
+// `Hash()` and `std::hash<rst::Value>` hash the structure of a value. Caching
+// is opt-in: `CachedHash()` stores the hashes of strings, arrays and objects in
+// their shared storage, where the non-const methods reset them. Hashing such a
+// value again or hashing its clones is O(1), and `operator==` rejects values
+// with different cached hashes without walking them. Since a child can't
+// reset the caches of its ancestors, references and pointers obtained from
+// non-const methods must not be used to modify a value after `CachedHash()`,
+// e.g. for read-only documents.
 //
 // Reading:
 //
@@ -96,7 +147,9 @@ namespace rst {
 // `std::string`, `rst::Value::Object`, `rst::Value::Array` are returned by
 // `rst::Nullable` pointer. `SetKey()`: Associates a `rst::Value` with a
 // `std::string` key. `RemoveKey()`: Removes the key from this object, if
-// present.
+// present. Objects keep their members in a vector sorted by key, so pointers to
+// the members are invalidated by `SetKey()` and `RemoveKey()` on the same
+// object.
 //
 // Objects also support an additional set of helper methods that operate on
 // "paths": `FindPath()`, and `SetPath()`.
@@ -113,11 +166,44 @@ namespace rst {
 //
 // If a path only has one component (i.e. has no dots), please use the regular,
 // non-path APIs.
+//
+// A path that is looked up often can be split once into a `rst::Value::Path`
+// and passed to `FindPath()` and `SetPath()` instead of the dotted string:
+//
+//   const rst::Value::Path path("aaa.bbb.ccc");
+//   auto value = object.FindPath(path);
 class Value {
  public:
-  using String = std::string;
-  using Array = std::vector<Value>;
-  using Object = std::map<std::string, Value, std::less<>>;
+  using String = std::pmr::string;
+  using Array = std::pmr::vector<Value>;
+  // Objects keep their keys in a sorted vector, see `rst::FlatMap`.
+  using Object =
+      FlatMap<String, Value, std::less<>,
+              std::pmr::polymorphic_allocator<std::pair<String, Value>>>;
+
+  // Makes arrays and objects pass their memory resource to the elements.
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  // A dotted path split into its keys.
+  class Path {
+   public:
+    explicit Path(std::string_view path);
+    ~Path();
+
+    Path(const Path&);
+    Path(Path&&) noexcept;
+
+    Path& operator=(const Path&);
+    Path& operator=(Path&&) noexcept;
+
+    // Returns the dotted path.
+    const std::string& path() const { return path_; }
+    const std::vector<std::string>& keys() const { return keys_; }
+
+   private:
+    std::string path_;
+    std::vector<std::string> keys_;
+  };
 
   // Types supported by JSON.
   enum class Type : int8_t {
@@ -130,14 +216,16 @@ class Value {
   };
 
   // Constructs the default value of a given type.
-  explicit Value(Type type);
+  explicit Value(Type type)
+      : Value(std::allocator_arg, allocator_type(), type) {}
 
   Value() : type_(Type::kNull) {}
   explicit Value(bool value) : type_(Type::kBool), bool_(value) {}
   explicit Value(int32_t value) : Value(static_cast<int64_t>(value)) {}
   // Can store |2^53 - 1| at maximum since it's a max safe integer that can be
   // stored in JavaScript.
-  explicit Value(int64_t value) : Value(static_cast<double>(value)) {
+  explicit Value(int64_t value)
+      : type_(Type::kNumber), is_int64_(true), int64_(value) {
     RST_DCHECK(std::abs(value) <= kMaxSafeInteger);
   }
 
@@ -149,30 +237,89 @@ class Value {
 
   // Provides const char* overload since otherwise it will be implicitly
   // converted to bool.
-  explicit Value(const char* value) : Value(String(value)) {
+  explicit Value(const char* value) : Value(std::string_view(value)) {
     RST_DCHECK(value != nullptr);
   }
+  explicit Value(std::string_view value)
+      : Value(std::allocator_arg, allocator_type(), value) {}
 
   explicit Value(String&& value)
-      : type_(Type::kString), string_(std::move(value)) {}
+      : type_(Type::kString),
+        string_(NewNode<String>(value.get_allocator(), std::move(value))) {}
   explicit Value(Array&& value)
-      : type_(Type::kArray), array_(std::move(value)) {}
+      : type_(Type::kArray),
+        array_(NewNode<Array>(value.get_allocator(), std::move(value))) {}
   explicit Value(Object&& value)
-      : type_(Type::kObject), object_(std::move(value)) {}
+      : type_(Type::kObject),
+        object_(NewNode<Object>(value.get_allocator(), std::move(value))) {}
 
   // Prevents Value(pointer) from accidentally producing a bool.
   explicit Value(void*) = delete;
 
+  // Allocator-extended constructors. Strings, arrays and objects are allocated
+  // from the memory resource of |allocator|. Arrays and objects use them to
+  // construct their elements.
+  Value(std::allocator_arg_t, const allocator_type&) : Value() {}
+  Value(std::allocator_arg_t, const allocator_type& allocator, Type type);
+  template <class T, class = std::enable_if_t<std::is_arithmetic_v<T>>>
+  Value(std::allocator_arg_t, const allocator_type&, const T value)
+      : Value(value) {}
+  Value(std::allocator_arg_t, const allocator_type& allocator,
+        const char* value)
+      : Value(std::allocator_arg, allocator, std::string_view(value)) {
+    RST_DCHECK(value != nullptr);
+  }
+  Value(std::allocator_arg_t, const allocator_type& allocator,
+        std::string_view value)
+      : type_(Type::kString), string_(NewNode<String>(allocator, value)) {}
+  Value(std::allocator_arg_t, const allocator_type& allocator, String&& value)
+      : type_(Type::kString),
+        string_(NewNode<String>(allocator, std::move(value))) {}
+  Value(std::allocator_arg_t, const allocator_type& allocator, Array&& value)
+      : type_(Type::kArray),
+        array_(NewNode<Array>(allocator, std::move(value))) {}
+  Value(std::allocator_arg_t, const allocator_type& allocator, Object&& value)
+      : type_(Type::kObject),
+        object_(NewNode<Object>(allocator, std::move(value))) {}
+  // Takes the payload of |other| if it uses the memory resource of
+  // |allocator|, otherwise copies it to the resource.
+  Value(std::allocator_arg_t, const allocator_type& allocator, Value&& other);
+
   Value(Value&& other) noexcept;
 
   ~Value();
 
   Value& operator=(Value&& rhs) noexcept;
 
-  // Creates an explicit copy.
-  Value Clone() const;
-  static Array Clone(const Array& array);
-  static Object Clone(const Object& object);
+  // Creates an explicit copy. Strings, arrays and objects of the copy are
+  // allocated from the memory resource of |allocator|. They are shared with
+  // this value if they already use that resource.
+  Value Clone(const allocator_type& allocator = allocator_type()) const;
+  static Array Clone(const Array& array,
+                     const allocator_type& allocator = allocator_type());
+  static Object Clone(const Object& object,
+                      const allocator_type& allocator = allocator_type());
+
+  // Returns the allocator of a string, an array or an object, the default
+  // allocator otherwise.
+  allocator_type get_allocator() const {
+    const auto resource = GetResource();
+    if (resource == nullptr)
+      return allocator_type();
+    return allocator_type(resource.get());
+  }
+
+  // Returns true if this value and |other| share their string, array or object,
+  // e.g. after `Clone()`. Such values are equal.
+  bool SharesStorageWith(const Value& other) const;
+
+  // Returns the structural hash of the value. Equal values have equal hashes.
+  // Numbers in [-1, 1] share a hash since they are compared with an absolute
+  // epsilon.
+  size_t Hash() const;
+  // Like `Hash()` but caches the hashes of the value and of its subtrees. See
+  // "Hashing" above.
+  size_t CachedHash() const;
 
   // Returns the type of the stored value.
   Type type() const { return type_; }
@@ -182,20 +329,28 @@ class Value {
   bool IsBool() const { return type() == Type::kBool; }
   bool IsNumber() const { return type() == Type::kNumber; }
   bool IsInt64() const {
-    return IsNumber() && (std::abs(get_number()) <= kMaxSafeInteger) &&
+    if (!IsNumber())
+      return false;
+    if (is_int64_)
+      return true;
+    return (std::abs(number_) <= kMaxSafeInteger) &&
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wfloat-equal"
-           (static_cast<double>(static_cast<int64_t>(get_number())) ==
-            get_number());
+           (static_cast<double>(static_cast<int64_t>(number_)) == number_);
 #pragma clang diagnostic pop
   }
   bool IsInt() const {
-    return IsNumber() && (get_number() >= std::numeric_limits<int>::min()) &&
-           (get_number() <= std::numeric_limits<int>::max()) &&
+    if (!IsNumber())
+      return false;
+    if (is_int64_) {
+      return (int64_ >= std::numeric_limits<int>::min()) &&
+             (int64_ <= std::numeric_limits<int>::max());
+    }
+    return (number_ >= std::numeric_limits<int>::min()) &&
+           (number_ <= std::numeric_limits<int>::max()) &&
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wfloat-equal"
-           (static_cast<double>(static_cast<int>(get_number())) ==
-            get_number());
+           (static_cast<double>(static_cast<int>(number_)) == number_);
 #pragma clang diagnostic pop
   }
   bool IsString() const { return type() == Type::kString; }
@@ -209,11 +364,11 @@ class Value {
   }
   int64_t GetInt64() const {
     RST_DCHECK(IsInt64());
-    return static_cast<int64_t>(get_number());
+    return get_int64();
   }
   int GetInt() const {
     RST_DCHECK(IsInt());
-    return static_cast<int>(get_number());
+    return static_cast<int>(get_int64());
   }
   double GetDouble() const {
     RST_DCHECK(IsNumber());
@@ -223,38 +378,41 @@ class Value {
     RST_DCHECK(IsString());
     return get_string();
   }
+  // Returns a copy of the string for the APIs that take `std::string`.
+  std::string GetStdString() const {
+    RST_DCHECK(IsString());
+    return std::string(get_string());
+  }
   String& GetString() {
-    return const_cast<String&>(std::as_const(*this).GetString());
+    RST_DCHECK(IsString());
+    return get_string();
   }
   const Array& GetArray() const {
     RST_DCHECK(IsArray());
     return get_array();
   }
   Array& GetArray() {
-    return const_cast<Array&>(std::as_const(*this).GetArray());
+    RST_DCHECK(IsArray());
+    return get_array();
   }
   const Object& GetObject() const {
     RST_DCHECK(IsObject());
     return get_object();
   }
   Object& GetObject() {
-    return const_cast<Object&>(std::as_const(*this).GetObject());
+    RST_DCHECK(IsObject());
+    return get_object();
   }
 
   // Looks up |key| in the underlying dictionary. Asserts that the value is
   // object.
   Nullable<const Value*> FindKey(std::string_view key) const;
-  Nullable<Value*> FindKey(std::string_view key) {
-    return const_cast<Value*>(std::as_const(*this).FindKey(key).get());
-  }
+  Nullable<Value*> FindKey(std::string_view key);
 
   // Similar to FindKey(), but it also requires the found value to have type
   // |type|. Asserts that the value is object.
   Nullable<const Value*> FindKeyOfType(std::string_view key, Type type) const;
-  Nullable<Value*> FindKeyOfType(std::string_view key, Type type) {
-    return const_cast<Value*>(
-        std::as_const(*this).FindKeyOfType(key, type).get());
-  }
+  Nullable<Value*> FindKeyOfType(std::string_view key, Type type);
 
   // These are convenience forms of FindKeyOfType(). Asserts that the value is
   // object.
@@ -273,7 +431,7 @@ class Value {
   // Looks up |key| in the underlying dictionary and sets the mapped value to
   // |value|. If |key| could not be found, a new element is inserted. A pointer
   // to the modified item is returned. Asserts that the value is object.
-  NotNull<Value*> SetKey(std::string&& key, Value&& value);
+  NotNull<Value*> SetKey(std::string_view key, Value&& value);
 
   // Attempts to remove the value associated with |key|. In case of failure,
   // e.g. the |key| does not exist, false is returned and the underlying
@@ -289,14 +447,15 @@ class Value {
   // be created and attached to the path in that location. A pointer to the
   // modified item is returned. Asserts that the value is object.
   NotNull<Value*> SetPath(std::string_view path, Value&& value);
+  NotNull<Value*> SetPath(const Path& path, Value&& value);
 
   // Finds the value associated with the given |path| starting from this
   // object. A |path| has the form "<key>" or "<key>.<key>.[...]", where "."
   // indexes into the next Value down. Asserts that the value is object.
   Nullable<const Value*> FindPath(std::string_view path) const;
-  Nullable<Value*> FindPath(std::string_view path) {
-    return const_cast<Value*>(std::as_const(*this).FindPath(path).get());
-  }
+  Nullable<Value*> FindPath(std::string_view path);
+  Nullable<const Value*> FindPath(const Path& path) const;
+  Nullable<Value*> FindPath(const Path& path);
 
  private:
   static constexpr int64_t kMaxSafeInteger =
@@ -305,43 +464,94 @@ class Value {
 
   friend bool operator==(const Value& lhs, const Value& rhs);
   friend bool operator<(const Value& lhs, const Value& rhs);
+  friend class internal::ValueMemoryUsageCalculator;
+
+  // A reference counted string, array or object shared by clones.
+  template <class T>
+  struct Node {
+    template <class... Args>
+    explicit Node(const allocator_type& allocator, Args&&... args)
+        : value(std::forward<Args>(args)..., allocator) {}
+
+    std::atomic<size_t> ref_count = 1;
+    // The cached hash of |value| or 0 if it is not computed yet.
+    std::atomic<size_t> hash = 0;
+    T value;
+  };
+
+  // Allocates a node of type |T| from the memory resource of |allocator| and
+  // constructs it from |args| with the same resource.
+  template <class T, class... Args>
+  static Node<T>* NewNode(const allocator_type& allocator, Args&&... args) {
+    std::pmr::polymorphic_allocator<Node<T>> node_allocator(allocator);
+    const auto node = node_allocator.allocate(1);
+    node_allocator.construct(node, allocator, std::forward<Args>(args)...);
+    return node;
+  }
+
+  // Decrements the reference count of |node| and deletes it when the last
+  // reference is gone.
+  template <class T>
+  static void DeleteNode(Node<T>* node) {
+    if (node->ref_count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+      return;
+
+    std::pmr::polymorphic_allocator<Node<T>> node_allocator(
+        node->value.get_allocator());
+    std::destroy_at(node);
+    node_allocator.deallocate(node, 1);
+  }
+
+  // Replaces a shared |node| with its own copy, so it can be modified.
+  template <class T>
+  static void Unshare(Node<T>*& node);
 
+  // Returns a value that shares the string, array or object with this one.
+  Value Share() const;
+
+  // Returns the cached hash of a string, an array or an object, nullptr
+  // otherwise.
+  Nullable<std::atomic<size_t>*> GetHashCache() const;
+  size_t ComputeHash(bool use_cache) const;
+
+  // Returns the memory resource of a string, an array or an object, nullptr
+  // otherwise.
+  Nullable<std::pmr::memory_resource*> GetResource() const;
+
+  // Takes the payload of |other| and leaves it null.
   void MoveConstruct(Value&& other);
-  void MoveAssign(Value&& rhs);
   void Cleanup();
 
-  const bool& get_bool() const { return *std::launder(&bool_); }
-  bool& get_bool() {
-    return const_cast<bool&>(std::as_const(*this).get_bool());
+  bool get_bool() const { return bool_; }
+  // Reads a number regardless of its representation. get_int64() requires the
+  // number to be an integer.
+  double get_number() const {
+    return is_int64_ ? static_cast<double>(int64_) : number_;
   }
-
-  const double& get_number() const { return *std::launder(&number_); }
-  double& get_number() {
-    return const_cast<double&>(std::as_const(*this).get_number());
+  int64_t get_int64() const {
+    return is_int64_ ? int64_ : static_cast<int64_t>(number_);
   }
 
-  const String& get_string() const { return *std::launder(&string_); }
-  String& get_string() {
-    return const_cast<String&>(std::as_const(*this).get_string());
-  }
+  // Non-const getters unshare the string, array or object.
+  const String& get_string() const { return string_->value; }
+  String& get_string();
 
-  const Array& get_array() const { return *std::launder(&array_); }
-  Array& get_array() {
-    return const_cast<Array&>(std::as_const(*this).get_array());
-  }
+  const Array& get_array() const { return array_->value; }
+  Array& get_array();
 
-  const Object& get_object() const { return *std::launder(&object_); }
-  Object& get_object() {
-    return const_cast<Object&>(std::as_const(*this).get_object());
-  }
+  const Object& get_object() const { return object_->value; }
+  Object& get_object();
 
   Type type_;
+  // Whether a number is stored in |int64_| rather than in |number_|.
+  bool is_int64_ = false;
   union {
     bool bool_;
+    int64_t int64_;
     double number_;
-    String string_;
-    Array array_;
-    Object object_;
+    Node<String>* string_;
+    Node<Array>* array_;
+    Node<Object>* object_;
   };
 
   RST_DISALLOW_COPY_AND_ASSIGN(Value);
@@ -362,4 +572,13 @@ inline bool operator>=(const Value& lhs, const Value& rhs) {
 
 }  // namespace rst
 
+namespace std {
+
+template <>
+struct hash<rst::Value> {
+  size_t operator()(const rst::Value& value) const { return value.Hash(); }
+};
+
+}  // namespace std
+
 #endif  // RST_VALUE_VALUE_H_
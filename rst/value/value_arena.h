@@ -0,0 +1,89 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_VALUE_ARENA_H_
+#define RST_VALUE_VALUE_ARENA_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Monotonic arena for `rst::Value` trees. Values constructed with `New()` and
+// their strings, arrays and objects are allocated from the arena and are never
+// destroyed: the whole tree is freed at once when the arena goes away, without
+// walking it.
+//
+// Values added to an arena tree through `SetKey()`, `SetPath()` or `emplace()`
+// of its arrays and objects are moved to the arena. Don't assign values backed
+// by another memory resource directly to the elements of an arena tree since
+// they would never be freed. Arena trees must not outlive the arena. The class
+// is not thread-safe.
+//
+// Example:
+//
+//   #include "rst/value/value_arena.h"
+//
+//   rst::ValueArena arena;
+//   rst::NotNull<rst::Value*> value = arena.New(rst::Value::Type::kObject);
+//   value->SetKey("key", rst::Value("value"));
+//
+class ValueArena {
+ public:
+  ValueArena() = default;
+  // |initial_size| is the size of the first memory block of the arena.
+  explicit ValueArena(const size_t initial_size) : resource_(initial_size) {}
+  ~ValueArena() = default;
+
+  // Constructs a value in the arena with the arguments of one of the `Value`
+  // constructors.
+  template <class... Args>
+  NotNull<Value*> New(Args&&... args) {
+    std::pmr::polymorphic_allocator<Value> allocator(&resource_);
+    const auto value = allocator.allocate(1);
+    allocator.construct(value, std::forward<Args>(args)...);
+    return value;
+  }
+
+  // Returns the allocator to construct values in the arena, e.g.
+  // rst::Value(std::allocator_arg, arena.allocator(), "string").
+  Value::allocator_type allocator() { return &resource_; }
+
+ private:
+  std::pmr::monotonic_buffer_resource resource_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ValueArena);
+};
+
+}  // namespace rst
+
+#endif  // RST_VALUE_VALUE_ARENA_H_
@@ -0,0 +1,143 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_arena.h"
+
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/value/json_reader.h"
+
+namespace rst {
+namespace {
+
+constexpr std::string_view kLongString =
+    "A string that doesn't fit into the small string buffer";
+
+std::pmr::memory_resource* GetResource(const Value& value) {
+  switch (value.type()) {
+    case Value::Type::kString:
+      return value.GetString().get_allocator().resource();
+    case Value::Type::kArray:
+      return value.GetArray().get_allocator().resource();
+    case Value::Type::kObject:
+      return value.GetObject().get_allocator().resource();
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace
+
+TEST(ValueArena, New) {
+  ValueArena arena;
+  const auto resource = arena.allocator().resource();
+
+  const auto value = arena.New(Value::Type::kObject);
+  EXPECT_EQ(GetResource(*value), resource);
+  EXPECT_EQ(GetResource(*arena.New(kLongString)), resource);
+  EXPECT_EQ(GetResource(*arena.New(Value::String(kLongString))), resource);
+  EXPECT_TRUE(arena.New()->IsNull());
+  EXPECT_EQ(arena.New(5)->GetInt(), 5);
+}
+
+TEST(ValueArena, ElementsUseArena) {
+  ValueArena arena;
+  const auto resource = arena.allocator().resource();
+
+  const auto array = arena.New(Value::Type::kArray);
+  array->GetArray().emplace_back(kLongString);
+  array->GetArray().emplace_back(Value(kLongString));
+  array->GetArray().emplace_back(Value::Type::kObject);
+  for (const auto& element : array->GetArray())
+    EXPECT_EQ(GetResource(element), resource);
+
+  auto& object = array->GetArray().back();
+  const auto set_key = object.SetKey(kLongString, Value(kLongString));
+  EXPECT_EQ(GetResource(*set_key), resource);
+  EXPECT_EQ(object.GetObject().begin()->first.get_allocator().resource(),
+            resource);
+
+  const auto overwritten = object.SetKey(kLongString, Value(kLongString));
+  EXPECT_EQ(GetResource(*overwritten), resource);
+
+  const auto set_path = object.SetPath("a.b", Value(kLongString));
+  EXPECT_EQ(GetResource(*set_path), resource);
+  const auto a = object.FindKey("a");
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(GetResource(*a), resource);
+}
+
+TEST(ValueArena, ParseJson) {
+  static constexpr std::string_view kJson =
+      R"({"a": ["A string that doesn't fit into the small string buffer"],
+          "b": {"c": "A string that doesn't fit into the small string buffer"}
+         })";
+
+  ValueArena arena;
+  const auto resource = arena.allocator().resource();
+
+  auto value = ParseJson(kJson, &arena);
+  ASSERT_FALSE(value.err());
+  const auto root = *value;
+  EXPECT_EQ(GetResource(*root), resource);
+  const auto a = root->FindKey("a");
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(GetResource(*a), resource);
+  EXPECT_EQ(GetResource(a->GetArray().front()), resource);
+  const auto c = root->FindPath("b.c");
+  ASSERT_NE(c, nullptr);
+  EXPECT_EQ(GetResource(*c), resource);
+
+  auto expected = ParseJson(kJson);
+  ASSERT_FALSE(expected.err());
+  EXPECT_EQ(*root, *expected);
+
+  EXPECT_TRUE(ParseJson("[1,]", &arena).err());
+}
+
+TEST(ValueArena, LeaveArena) {
+  ValueArena arena;
+  const auto value = arena.New(Value::Type::kArray);
+  value->GetArray().emplace_back(kLongString);
+
+  const auto clone = value->Clone();
+  EXPECT_EQ(GetResource(clone), std::pmr::get_default_resource());
+  EXPECT_EQ(GetResource(clone.GetArray().front()),
+            std::pmr::get_default_resource());
+  EXPECT_EQ(clone, *value);
+
+  Value::Array array;
+  array.emplace_back(std::move(value->GetArray().front()));
+  EXPECT_EQ(GetResource(array.front()), std::pmr::get_default_resource());
+  EXPECT_EQ(array.front().GetString(), kLongString);
+}
+
+}  // namespace rst
@@ -0,0 +1,445 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_diff.h"
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "rst/check/check.h"
+#include "rst/status/status_macros.h"
+#include "rst/strings/str_cat.h"
+
+namespace rst {
+namespace {
+
+// Returns true if |lhs| and |rhs| are known to be equal without walking their
+// arrays or objects.
+bool IsIdentical(const Value& lhs, const Value& rhs) {
+  if (lhs.SharesStorageWith(rhs))
+    return true;
+  if (lhs.IsArray() || lhs.IsObject())
+    return false;
+  return lhs == rhs;
+}
+
+// Appends a JSON Pointer reference token to |path|, escaping '~' and '/'.
+void AppendReferenceToken(const std::string_view token,
+                          const NotNull<std::string*> path) {
+  path->push_back('/');
+  for (const auto c : token) {
+    switch (c) {
+      case '~':
+        path->append("~0");
+        break;
+      case '/':
+        path->append("~1");
+        break;
+      default:
+        path->push_back(c);
+        break;
+    }
+  }
+}
+
+class Differ {
+ public:
+  explicit Differ(const NotNull<Value*> patch) : patch_(patch) {}
+
+  void Diff(const Value& from, const Value& to) {
+    if (from.SharesStorageWith(to))
+      return;
+
+    if (from.type() != to.type()) {
+      AddOperation("replace", &to);
+      return;
+    }
+
+    switch (to.type()) {
+      case Value::Type::kNull:
+      case Value::Type::kBool:
+      case Value::Type::kNumber:
+      case Value::Type::kString:
+        if (from != to)
+          AddOperation("replace", &to);
+        return;
+      case Value::Type::kArray:
+        DiffArrays(from.GetArray(), to.GetArray());
+        return;
+      case Value::Type::kObject:
+        DiffObjects(from.GetObject(), to.GetObject());
+        return;
+    }
+
+    RST_NOTREACHED();
+  }
+
+ private:
+  void DiffArrays(const Value::Array& from, const Value::Array& to) {
+    const auto size = std::min(from.size(), to.size());
+
+    size_t prefix = 0;
+    while (prefix < size && IsIdentical(from[prefix], to[prefix]))
+      prefix++;
+
+    size_t suffix = 0;
+    while (suffix < size - prefix &&
+           IsIdentical(from[from.size() - 1 - suffix],
+                       to[to.size() - 1 - suffix])) {
+      suffix++;
+    }
+
+    const auto from_end = from.size() - suffix;
+    const auto to_end = to.size() - suffix;
+    const auto common_end = std::min(from_end, to_end);
+
+    for (auto i = prefix; i < common_end; i++) {
+      const auto path_size = PushIndex(i);
+      Diff(from[i], to[i]);
+      path_.resize(path_size);
+    }
+
+    for (auto i = common_end; i < to_end; i++) {
+      const auto path_size = PushIndex(i);
+      AddOperation("add", &to[i]);
+      path_.resize(path_size);
+    }
+
+    for (auto i = from_end; i > common_end; i--) {
+      const auto path_size = PushIndex(i - 1);
+      AddOperation("remove", nullptr);
+      path_.resize(path_size);
+    }
+  }
+
+  void DiffObjects(const Value::Object& from, const Value::Object& to) {
+    auto from_it = from.cbegin();
+    auto to_it = to.cbegin();
+    while (from_it != from.cend() || to_it != to.cend()) {
+      if (to_it == to.cend() ||
+          (from_it != from.cend() && from_it->first < to_it->first)) {
+        const auto path_size = PushKey(from_it->first);
+        AddOperation("remove", nullptr);
+        path_.resize(path_size);
+        ++from_it;
+      } else if (from_it == from.cend() || to_it->first < from_it->first) {
+        const auto path_size = PushKey(to_it->first);
+        AddOperation("add", &to_it->second);
+        path_.resize(path_size);
+        ++to_it;
+      } else {
+        if (!from_it->second.SharesStorageWith(to_it->second)) {
+          const auto path_size = PushKey(to_it->first);
+          Diff(from_it->second, to_it->second);
+          path_.resize(path_size);
+        }
+        ++from_it;
+        ++to_it;
+      }
+    }
+  }
+
+  // Appends a reference token to the current path and returns the previous
+  // size of the path.
+  size_t PushKey(const std::string_view key) {
+    const auto path_size = path_.size();
+    AppendReferenceToken(key, &path_);
+    return path_size;
+  }
+  size_t PushIndex(const size_t index) {
+    const auto path_size = path_.size();
+    char buffer[24];
+    const auto [ptr, ec] =
+        std::to_chars(std::begin(buffer), std::end(buffer), index);
+    RST_DCHECK(ec == std::errc());
+    path_.push_back('/');
+    path_.append(buffer, static_cast<size_t>(ptr - buffer));
+    return path_size;
+  }
+
+  void AddOperation(const std::string_view op,
+                    const Nullable<const Value*> value) {
+    Value operation(Value::Type::kObject);
+    operation.SetKey("op", Value(op));
+    operation.SetKey("path", Value(path_));
+    if (value != nullptr)
+      operation.SetKey("value", value->Clone());
+    patch_->GetArray().emplace_back(std::move(operation));
+  }
+
+  const NotNull<Value*> patch_;
+  std::string path_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(Differ);
+};
+
+// Splits a JSON Pointer into unescaped reference tokens.
+std::optional<std::vector<std::string>> ParsePointer(
+    const std::string_view pointer) {
+  std::vector<std::string> tokens;
+  if (pointer.empty())
+    return tokens;
+  if (pointer.front() != '/')
+    return std::optional<std::vector<std::string>>();
+
+  for (size_t i = 1; i <= pointer.size(); i++) {
+    if (i == 1 || pointer[i - 1] == '/')
+      tokens.emplace_back();
+    if (i == pointer.size())
+      break;
+
+    const auto c = pointer[i];
+    if (c == '/')
+      continue;
+    if (c != '~') {
+      tokens.back().push_back(c);
+      continue;
+    }
+
+    i++;
+    if (i == pointer.size())
+      return std::optional<std::vector<std::string>>();
+    switch (pointer[i]) {
+      case '0':
+        tokens.back().push_back('~');
+        break;
+      case '1':
+        tokens.back().push_back('/');
+        break;
+      default:
+        return std::optional<std::vector<std::string>>();
+    }
+  }
+
+  return tokens;
+}
+
+// Parses an array index without leading zeros.
+std::optional<size_t> ParseIndex(const std::string_view token) {
+  if (token.empty() || (token.size() > 1 && token.front() == '0'))
+    return std::nullopt;
+
+  size_t index = 0;
+  const auto end = token.data() + token.size();
+  const auto [ptr, ec] = std::from_chars(token.data(), end, index);
+  if (ec != std::errc() || ptr != end)
+    return std::nullopt;
+  return index;
+}
+
+Nullable<Value*> FindChild(const NotNull<Value*> value,
+                           const std::string_view token) {
+  if (value->IsObject())
+    return value->FindKey(token);
+
+  if (value->IsArray()) {
+    const auto index = ParseIndex(token);
+    auto& array = value->GetArray();
+    if (!index.has_value() || *index >= array.size())
+      return nullptr;
+    return &array[*index];
+  }
+
+  return nullptr;
+}
+
+class PatchApplier {
+ public:
+  PatchApplier(const Value& operation, const size_t index,
+               const NotNull<Value*> value)
+      : operation_(operation), index_(index), value_(value) {}
+
+  Status Apply() {
+    if (!operation_.IsObject())
+      return Error("Operation is not an object");
+
+    const auto op = operation_.FindStringKey("op");
+    if (op == nullptr)
+      return Error("Missing operation");
+    const auto path = operation_.FindStringKey("path");
+    if (path == nullptr)
+      return Error("Missing path");
+
+    const auto tokens = ParsePointer(*path);
+    if (!tokens.has_value())
+      return Error("Invalid path");
+
+    if (*op == "add")
+      return Add(*tokens);
+    if (*op == "remove")
+      return Remove(*tokens);
+    if (*op == "replace")
+      return Replace(*tokens);
+    return Error("Unsupported operation");
+  }
+
+ private:
+  Status Add(const std::vector<std::string>& tokens) {
+    RST_TRY_CREATE(auto, value, GetValue());
+    if (tokens.empty()) {
+      *value_ = (*value)->Clone(value_->get_allocator());
+      return Status::OK();
+    }
+
+    RST_TRY_CREATE(auto, parent, FindParent(tokens));
+    const auto& key = tokens.back();
+    if ((*parent)->IsObject()) {
+      (*parent)->SetKey(key, (*value)->Clone((*parent)->get_allocator()));
+      return Status::OK();
+    }
+
+    if ((*parent)->IsArray()) {
+      auto& array = (*parent)->GetArray();
+      if (key == "-") {
+        array.emplace_back((*value)->Clone(array.get_allocator()));
+        return Status::OK();
+      }
+
+      const auto index = ParseIndex(key);
+      if (!index.has_value() || *index > array.size())
+        return Error("Invalid array index");
+      array.emplace(array.cbegin() + static_cast<ptrdiff_t>(*index),
+                    (*value)->Clone(array.get_allocator()));
+      return Status::OK();
+    }
+
+    return Error("Path not found");
+  }
+
+  Status Remove(const std::vector<std::string>& tokens) {
+    if (tokens.empty())
+      return Error("Cannot remove the root");
+
+    RST_TRY_CREATE(auto, parent, FindParent(tokens));
+    const auto& key = tokens.back();
+    if ((*parent)->IsObject()) {
+      if (!(*parent)->RemoveKey(key))
+        return Error("Path not found");
+      return Status::OK();
+    }
+
+    if ((*parent)->IsArray()) {
+      auto& array = (*parent)->GetArray();
+      const auto index = ParseIndex(key);
+      if (!index.has_value() || *index >= array.size())
+        return Error("Path not found");
+      array.erase(array.cbegin() + static_cast<ptrdiff_t>(*index));
+      return Status::OK();
+    }
+
+    return Error("Path not found");
+  }
+
+  Status Replace(const std::vector<std::string>& tokens) {
+    RST_TRY_CREATE(auto, value, GetValue());
+    if (tokens.empty()) {
+      *value_ = (*value)->Clone(value_->get_allocator());
+      return Status::OK();
+    }
+
+    RST_TRY_CREATE(auto, parent, FindParent(tokens));
+    const auto target = FindChild(*parent, tokens.back());
+    if (target == nullptr)
+      return Error("Path not found");
+    *target = (*value)->Clone((*parent)->get_allocator());
+    return Status::OK();
+  }
+
+  // Returns the value of the operation.
+  StatusOr<NotNull<const Value*>> GetValue() const {
+    const auto value = operation_.FindKey("value");
+    if (value == nullptr)
+      return Error("Missing value");
+    return NotNull<const Value*>(value);
+  }
+
+  // Returns the container of the last token of the path.
+  StatusOr<NotNull<Value*>> FindParent(const std::vector<std::string>& tokens) {
+    RST_DCHECK(!tokens.empty());
+    NotNull<Value*> current = value_;
+    for (size_t i = 0; i < tokens.size() - 1; i++) {
+      const auto child = FindChild(current, tokens[i]);
+      if (child == nullptr)
+        return Error("Path not found");
+      current = child;
+    }
+
+    return current;
+  }
+
+  Status Error(const std::string_view message) const {
+    return MakeStatus<JsonPatchError>(message, index_);
+  }
+
+  const Value& operation_;
+  const size_t index_;
+  const NotNull<Value*> value_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(PatchApplier);
+};
+
+}  // namespace
+
+char JsonPatchError::id_ = '\0';
+
+JsonPatchError::JsonPatchError(const std::string_view message,
+                               const size_t operation)
+    : message_(StrCat({message, " at operation ", operation})),
+      operation_(operation) {}
+
+JsonPatchError::~JsonPatchError() = default;
+
+const std::string& JsonPatchError::AsString() const { return message_; }
+
+Value Diff(const Value& from, const Value& to) {
+  Value patch(Value::Type::kArray);
+  Differ differ(&patch);
+  differ.Diff(from, to);
+  return patch;
+}
+
+Status ApplyPatch(const Value& patch, const NotNull<Value*> value) {
+  if (!patch.IsArray())
+    return MakeStatus<JsonPatchError>("Patch is not an array", 0);
+
+  // Patches a shallow copy, so the value is unchanged on failure.
+  auto result = value->Clone(value->get_allocator());
+  const auto& operations = patch.GetArray();
+  for (size_t i = 0; i < operations.size(); i++) {
+    PatchApplier applier(operations[i], i, &result);
+    RST_TRY(applier.Apply());
+  }
+
+  *value = std::move(result);
+  return Status::OK();
+}
+
+}  // namespace rst
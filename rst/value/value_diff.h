@@ -0,0 +1,103 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_VALUE_DIFF_H_
+#define RST_VALUE_VALUE_DIFF_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+class JsonPatchError final : public ErrorInfo<JsonPatchError> {
+ public:
+  JsonPatchError(std::string_view message, size_t operation);
+  ~JsonPatchError() override;
+
+  // ErrorInfo:
+  const std::string& AsString() const override;
+
+  // Returns the index of the failed operation in the patch.
+  size_t operation() const { return operation_; }
+
+  static char id_;
+
+ private:
+  const std::string message_;
+  const size_t operation_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(JsonPatchError);
+};
+
+// Returns a JSON Patch (RFC 6902) that transforms |from| into |to|: an array of
+// objects with the "op" ("add", "remove" or "replace"), the "path" (a JSON
+// Pointer, RFC 6901) and the "value" for additions and replacements. Subtrees
+// that share their storage, see `rst::Value::Clone()`, are skipped without
+// being compared, so diffing a clone with a few modifications takes time
+// proportional to the modified paths. Objects are diffed key by key. Arrays
+// are diffed element by element after skipping common prefixes and suffixes
+// of such shared or equal scalar elements, so a single insertion or removal is
+// found, but moved elements are reported as replacements. The values in the
+// patch share their storage with |to|.
+//
+// Example:
+//
+//   #include "rst/value/value_diff.h"
+//
+//   const rst::Value& before = ...;
+//   rst::Value after = before.Clone();
+//   after.SetPath("a.b", rst::Value(1));
+//   const rst::Value patch = rst::Diff(before, after);
+//   // [{"op": "replace", "path": "/a/b", "value": 1}]
+//
+Value Diff(const Value& from, const Value& to);
+
+// Applies the JSON Patch |patch| to |value|. Supports the "add", "remove" and
+// "replace" operations. Either all operations are applied or, if one of them
+// fails, e.g. its path doesn't exist, |value| is left unchanged and
+// `rst::JsonPatchError` with the index of the operation is returned. Unchanged
+// subtrees keep sharing their storage with the previous clones of |value|.
+//
+// Example:
+//
+//   #include "rst/value/value_diff.h"
+//
+//   rst::Value value = ...;
+//   const rst::Value& patch = ...;
+//   rst::Status status = rst::ApplyPatch(patch, &value);
+//
+Status ApplyPatch(const Value& patch, NotNull<Value*> value);
+
+}  // namespace rst
+
+#endif  // RST_VALUE_VALUE_DIFF_H_
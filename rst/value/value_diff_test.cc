@@ -0,0 +1,189 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_diff.h"
+
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/rtti/rtti.h"
+#include "rst/value/value_test_util.h"
+
+namespace rst {
+namespace {
+
+// Diffs the values and checks that the patch transforms |from| into |to|.
+Value DiffAndApply(const std::string_view from, const std::string_view to) {
+  auto value = ParseJsonOrDie(from);
+  const auto expected = ParseJsonOrDie(to);
+  auto patch = Diff(value, expected);
+  auto status = ApplyPatch(patch, &value);
+  RST_CHECK(!status.err());
+  RST_CHECK(value == expected);
+  return patch;
+}
+
+size_t ErrorOperation(const std::string_view patch,
+                      const NotNull<Value*> value) {
+  auto status = ApplyPatch(ParseJsonOrDie(patch), value);
+  RST_CHECK(status.err());
+  const auto error = dyn_cast<JsonPatchError>(status.GetError());
+  RST_CHECK(error != nullptr);
+  return error->operation();
+}
+
+}  // namespace
+
+TEST(Diff, SharedValues) {
+  const auto value = ParseJsonOrDie(R"({"a": [1, {"b": "c"}], "d": null})");
+  EXPECT_EQ(Diff(value, value.Clone()), Value(Value::Type::kArray));
+
+  auto modified = value.Clone();
+  modified.SetKey("d", Value(1));
+  EXPECT_EQ(Diff(value, modified), ParseJsonOrDie(R"([
+    {"op": "replace", "path": "/d", "value": 1}
+  ])"));
+}
+
+TEST(Diff, Scalars) {
+  EXPECT_EQ(DiffAndApply("1", "1"), Value(Value::Type::kArray));
+  EXPECT_EQ(DiffAndApply(R"("a")", R"("a")"), Value(Value::Type::kArray));
+  EXPECT_EQ(DiffAndApply("1", "2"), ParseJsonOrDie(R"([
+    {"op": "replace", "path": "", "value": 2}
+  ])"));
+  EXPECT_EQ(DiffAndApply("[]", "{}"), ParseJsonOrDie(R"([
+    {"op": "replace", "path": "", "value": {}}
+  ])"));
+}
+
+TEST(Diff, Objects) {
+  EXPECT_EQ(DiffAndApply(R"({"a": 1, "b": {"c": true}, "d": "e"})",
+                         R"({"b": {"c": false}, "d": "e", "f": null})"),
+            ParseJsonOrDie(R"([
+              {"op": "remove", "path": "/a"},
+              {"op": "replace", "path": "/b/c", "value": false},
+              {"op": "add", "path": "/f", "value": null}
+            ])"));
+  EXPECT_EQ(DiffAndApply(R"({"a/b": 1, "c~d": 2})", R"({"a/b": 3})"),
+            ParseJsonOrDie(R"([
+              {"op": "replace", "path": "/a~1b", "value": 3},
+              {"op": "remove", "path": "/c~0d"}
+            ])"));
+}
+
+TEST(Diff, Arrays) {
+  EXPECT_EQ(DiffAndApply("[1, 2, 3]", "[1, 4, 2, 3]"), ParseJsonOrDie(R"([
+    {"op": "add", "path": "/1", "value": 4}
+  ])"));
+  EXPECT_EQ(DiffAndApply("[1, 2, 3]", "[1, 3]"), ParseJsonOrDie(R"([
+    {"op": "remove", "path": "/1"}
+  ])"));
+  EXPECT_EQ(DiffAndApply("[1, 2]", "[1, 2, 3, 4]"), ParseJsonOrDie(R"([
+    {"op": "add", "path": "/2", "value": 3},
+    {"op": "add", "path": "/3", "value": 4}
+  ])"));
+  EXPECT_EQ(DiffAndApply("[1, 2, 3, 4]", "[1]"), ParseJsonOrDie(R"([
+    {"op": "remove", "path": "/3"},
+    {"op": "remove", "path": "/2"},
+    {"op": "remove", "path": "/1"}
+  ])"));
+  EXPECT_EQ(DiffAndApply(R"([{"a": 1}, 2])", R"([{"a": 2}, 2])"),
+            ParseJsonOrDie(R"([
+              {"op": "replace", "path": "/0/a", "value": 2}
+            ])"));
+  DiffAndApply("[1, 2, 3]", "[3, 2, 1]");
+  DiffAndApply("[[], [1], [1, 2]]", "[[1, 2], [], [1]]");
+}
+
+TEST(ApplyPatch, Operations) {
+  auto value = ParseJsonOrDie(R"({"a": [1, 2], "b": {"c": 3}})");
+  const auto clone = value.Clone();
+  auto status = ApplyPatch(ParseJsonOrDie(R"([
+    {"op": "add", "path": "/a/-", "value": 4},
+    {"op": "add", "path": "/a/0", "value": 0},
+    {"op": "remove", "path": "/a/1"},
+    {"op": "add", "path": "/d", "value": {"e": "f"}},
+    {"op": "replace", "path": "/d/e", "value": "g"},
+    {"op": "add", "path": "/a/3", "value": 5}
+  ])"),
+                           &value);
+  ASSERT_FALSE(status.err());
+  EXPECT_EQ(value, ParseJsonOrDie(R"({
+    "a": [0, 2, 4, 5], "b": {"c": 3}, "d": {"e": "g"}
+  })"));
+
+  const auto b = value.FindKey("b");
+  ASSERT_NE(b, nullptr);
+  const auto clone_b = clone.FindKey("b");
+  ASSERT_NE(clone_b, nullptr);
+  EXPECT_TRUE(std::as_const(*b).SharesStorageWith(*clone_b));
+  EXPECT_EQ(clone, ParseJsonOrDie(R"({"a": [1, 2], "b": {"c": 3}})"));
+
+  status = ApplyPatch(ParseJsonOrDie(R"([
+    {"op": "replace", "path": "", "value": [1]}
+  ])"),
+                      &value);
+  ASSERT_FALSE(status.err());
+  EXPECT_EQ(value, ParseJsonOrDie("[1]"));
+}
+
+TEST(ApplyPatch, Errors) {
+  const auto original = ParseJsonOrDie(R"({"a": [1, 2], "b": {"c": 3}})");
+  auto value = original.Clone();
+
+  EXPECT_EQ(ErrorOperation("{}", &value), 0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "/x", "value": 1},
+                               {"op": "remove", "path": "/y"}])",
+                           &value),
+            1U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "move", "path": "/a"}])", &value), 0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "/a/3", "value": 1}])",
+                           &value),
+            0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "/a/01", "value": 1}])",
+                           &value),
+            0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "replace", "path": "/b/d", "value": 1}])",
+                           &value),
+            0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "/x/y", "value": 1}])",
+                           &value),
+            0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "a", "value": 1}])",
+                           &value),
+            0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "/~2", "value": 1}])",
+                           &value),
+            0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "add", "path": "/x"}])", &value), 0U);
+  EXPECT_EQ(ErrorOperation(R"([{"op": "remove", "path": ""}])", &value), 0U);
+  EXPECT_EQ(value, original);
+}
+
+}  // namespace rst
@@ -0,0 +1,156 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_memory_usage.h"
+
+#include <functional>
+#include <unordered_set>
+
+#include "rst/check/check.h"
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/strings/str_cat.h"
+
+namespace rst {
+namespace internal {
+
+class ValueMemoryUsageCalculator {
+ public:
+  ValueMemoryUsageCalculator(const size_t path_depth,
+                             const NotNull<ValueMemoryUsage*> usage)
+      : path_depth_(path_depth), usage_(usage) {}
+  ~ValueMemoryUsageCalculator() = default;
+
+  // Returns the heap bytes of |value| at |depth| levels below the root.
+  size_t Add(const Value& value, const size_t depth) {
+    switch (value.type()) {
+      case Value::Type::kNull:
+      case Value::Type::kBool:
+      case Value::Type::kNumber:
+        return 0;
+      case Value::Type::kString: {
+        const auto node = value.string_;
+        if (!Visit(node, node->ref_count))
+          return 0;
+        const auto bytes = sizeof(*node) + GetStringHeapBytes(node->value);
+        usage_->strings += bytes;
+        return bytes;
+      }
+      case Value::Type::kArray: {
+        const auto node = value.array_;
+        if (!Visit(node, node->ref_count))
+          return 0;
+        const auto& array = node->value;
+        auto bytes = sizeof(*node) + array.capacity() * sizeof(Value);
+        usage_->arrays += bytes;
+        for (size_t i = 0; i < array.size(); i++)
+          bytes += AddChild(i, array[i], depth);
+        return bytes;
+      }
+      case Value::Type::kObject: {
+        const auto node = value.object_;
+        if (!Visit(node, node->ref_count))
+          return 0;
+        const auto& object = node->value;
+        auto own_bytes = sizeof(*node) +
+                         object.capacity() * sizeof(Value::Object::value_type);
+        for (const auto& [key, child] : object)
+          own_bytes += GetStringHeapBytes(key);
+        usage_->objects += own_bytes;
+
+        auto bytes = own_bytes;
+        for (const auto& [key, child] : object)
+          bytes += AddChild(std::string_view(key), child, depth);
+        return bytes;
+      }
+    }
+
+    RST_NOTREACHED();
+    return 0;
+  }
+
+ private:
+  // Adds |child| of a value at |depth| and records its usage by its path.
+  template <class Key>
+  size_t AddChild(const Key& key, const Value& child, const size_t depth) {
+    if (depth >= path_depth_)
+      return Add(child, depth + 1);
+
+    const auto path_size = path_.size();
+    if (depth != 0)
+      path_.push_back('.');
+    path_.append(StrCat({key}));
+    const auto bytes = Add(child, depth + 1);
+    usage_->paths[path_] += bytes;
+    path_.resize(path_size);
+    return bytes;
+  }
+
+  // Returns false if |node| has been counted already. Only shared nodes are
+  // remembered.
+  bool Visit(const NotNull<const void*> node, const size_t ref_count) {
+    if (ref_count == 1)
+      return true;
+    return visited_.insert(node.get()).second;
+  }
+
+  // Returns the size of the heap buffer of |string|, 0 if the characters are
+  // stored inline.
+  static size_t GetStringHeapBytes(const Value::String& string) {
+    const auto data = static_cast<const void*>(string.data());
+    const auto begin = static_cast<const void*>(&string);
+    const auto end = static_cast<const void*>(&string + 1);
+    const std::less<const void*> less;
+    if (!less(data, begin) && less(data, end))
+      return 0;
+    return string.capacity() + 1;
+  }
+
+  const size_t path_depth_;
+  const NotNull<ValueMemoryUsage*> usage_;
+  std::string path_;
+  std::unordered_set<const void*> visited_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ValueMemoryUsageCalculator);
+};
+
+}  // namespace internal
+
+size_t EstimateMemoryUsage(const Value& value) {
+  return GetMemoryUsage(value, ValueMemoryUsagePathDepth(0)).total;
+}
+
+ValueMemoryUsage GetMemoryUsage(const Value& value,
+                                const ValueMemoryUsagePathDepth path_depth) {
+  ValueMemoryUsage usage;
+  internal::ValueMemoryUsageCalculator calculator(path_depth.value(), &usage);
+  usage.total = calculator.Add(value, 0);
+  RST_DCHECK(usage.total == usage.strings + usage.arrays + usage.objects);
+  return usage;
+}
+
+}  // namespace rst
@@ -0,0 +1,95 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_VALUE_MEMORY_USAGE_H_
+#define RST_VALUE_VALUE_MEMORY_USAGE_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "rst/type/type.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Number of levels below the root for which `rst::GetMemoryUsage()` reports
+// the usage of every subtree.
+using ValueMemoryUsagePathDepth =
+    Type<class ValueMemoryUsagePathDepthTag, size_t>;
+
+// Heap memory of a `rst::Value` tree in bytes.
+struct ValueMemoryUsage {
+  // Sum of the fields below.
+  size_t total = 0;
+  // Strings with their reference counted storage.
+  size_t strings = 0;
+  // The storage of arrays including the slack of their vectors.
+  size_t arrays = 0;
+  // The storage of objects including the slack of their vectors and the keys.
+  size_t objects = 0;
+  // Usage of the subtrees by their paths, e.g. "a.b". Array elements are
+  // named by their indices, e.g. "a.0".
+  std::map<std::string, size_t> paths;
+};
+
+// Returns the number of heap bytes a value holds: the capacity of its strings
+// and vectors, the keys of its objects and the reference counted storage that
+// contains them. `sizeof(rst::Value)` of the value itself is not included.
+// Storage shared within the tree, e.g. by inserted clones, is counted once.
+// Storage shared with values outside of the tree is counted in full, so the
+// usage of clones doesn't add up.
+//
+// Example:
+//
+//   #include "rst/value/value_memory_usage.h"
+//
+//   const rst::Value& value = ...;
+//   size_t bytes = rst::EstimateMemoryUsage(value);
+//
+size_t EstimateMemoryUsage(const Value& value);
+
+// Like `rst::EstimateMemoryUsage()` but breaks the usage down by type and by
+// the paths of the subtrees up to |path_depth| levels below the root.
+//
+// Example:
+//
+//   #include "rst/value/value_memory_usage.h"
+//
+//   const rst::Value& snapshot = ...;
+//   rst::ValueMemoryUsage usage =
+//       rst::GetMemoryUsage(snapshot, rst::ValueMemoryUsagePathDepth(2));
+//   for (const auto& [path, bytes] : usage.paths)
+//     std::cout << path << ": " << bytes << std::endl;
+//
+ValueMemoryUsage GetMemoryUsage(
+    const Value& value,
+    ValueMemoryUsagePathDepth path_depth = ValueMemoryUsagePathDepth(1));
+
+}  // namespace rst
+
+#endif  // RST_VALUE_VALUE_MEMORY_USAGE_H_
@@ -0,0 +1,116 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_memory_usage.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/memory/tracking_memory_resource.h"
+
+namespace rst {
+
+TEST(ValueMemoryUsage, Scalars) {
+  EXPECT_EQ(EstimateMemoryUsage(Value()), 0U);
+  EXPECT_EQ(EstimateMemoryUsage(Value(true)), 0U);
+  EXPECT_EQ(EstimateMemoryUsage(Value(1)), 0U);
+  EXPECT_EQ(EstimateMemoryUsage(Value(1.5)), 0U);
+  EXPECT_GT(EstimateMemoryUsage(Value("")), 0U);
+  EXPECT_GT(EstimateMemoryUsage(Value(std::string(100, 'a'))),
+            EstimateMemoryUsage(Value("")) + 100);
+}
+
+TEST(ValueMemoryUsage, MatchesAllocations) {
+  TrackingMemoryResource resource;
+  {
+    const Value::allocator_type allocator(&resource);
+    Value value(std::allocator_arg, allocator, Value::Type::kObject);
+    value.SetKey("short", Value("a"));
+    value.SetKey(std::string(50, 'k'), Value(std::string(100, 'v')));
+    auto array = value.SetKey("array", Value(Value::Type::kArray));
+    for (auto i = 0; i < 5; i++)
+      array->GetArray().emplace_back(i);
+    array->GetArray().emplace_back(Value::Type::kObject);
+    value.SetPath("a.b.c", Value(true));
+
+    EXPECT_EQ(EstimateMemoryUsage(value), resource.allocated_bytes());
+  }
+  EXPECT_EQ(resource.allocated_bytes(), 0U);
+}
+
+TEST(ValueMemoryUsage, SharedStorage) {
+  Value value(Value::Type::kArray);
+  value.GetArray().emplace_back(std::string(100, 'a'));
+  const auto bytes = EstimateMemoryUsage(value);
+
+  Value clone = value.Clone();
+  EXPECT_EQ(EstimateMemoryUsage(clone), bytes);
+
+  Value object(Value::Type::kObject);
+  object.SetKey("a", value.Clone());
+  object.SetKey("b", std::move(clone));
+  const auto usage = GetMemoryUsage(object);
+  EXPECT_EQ(usage.paths.at("a"), bytes);
+  EXPECT_EQ(usage.paths.at("b"), 0U);
+  EXPECT_LT(usage.total, 2 * bytes);
+}
+
+TEST(ValueMemoryUsage, Breakdown) {
+  Value value(Value::Type::kObject);
+  value.SetPath("a.b", Value(std::string(100, 'a')));
+  auto array = value.SetKey("c", Value(Value::Type::kArray));
+  array->GetArray().emplace_back(Value::Type::kObject);
+  array->GetArray().emplace_back(1);
+
+  const auto usage = GetMemoryUsage(value, ValueMemoryUsagePathDepth(2));
+  EXPECT_EQ(usage.total, EstimateMemoryUsage(value));
+  EXPECT_EQ(usage.total, usage.strings + usage.arrays + usage.objects);
+  EXPECT_GT(usage.strings, 100U);
+  EXPECT_GT(usage.arrays, 2 * sizeof(Value));
+  EXPECT_GT(usage.objects, 0U);
+
+  std::map<std::string, size_t> expected_paths;
+  const auto a = value.FindKey("a");
+  ASSERT_NE(a, nullptr);
+  expected_paths["a"] = EstimateMemoryUsage(*a);
+  const auto b = value.FindPath("a.b");
+  ASSERT_NE(b, nullptr);
+  expected_paths["a.b"] = EstimateMemoryUsage(*b);
+  expected_paths["c"] = EstimateMemoryUsage(*array);
+  expected_paths["c.0"] = EstimateMemoryUsage(array->GetArray()[0]);
+  expected_paths["c.1"] = 0;
+  EXPECT_EQ(usage.paths, expected_paths);
+
+  EXPECT_TRUE(
+      GetMemoryUsage(value, ValueMemoryUsagePathDepth(0)).paths.empty());
+}
+
+}  // namespace rst
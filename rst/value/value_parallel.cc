@@ -0,0 +1,147 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_parallel.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "rst/check/check.h"
+#include "rst/macros/macros.h"
+
+namespace rst {
+namespace {
+
+// Containers with fewer elements are cloned on the calling thread.
+constexpr size_t kMinParallelSize = 1024;
+
+class ParallelCloner {
+ public:
+  ParallelCloner(const NotNull<TaskRunner*> task_runner,
+                 const ValueCloneParallelism parallelism,
+                 const Value::allocator_type& allocator)
+      : task_runner_(*task_runner),
+        parallelism_(parallelism.value()),
+        allocator_(allocator) {
+    RST_DCHECK(parallelism_ > 0);
+  }
+
+  Value Clone(const Value& value) {
+    if (!value.IsArray() && !value.IsObject())
+      return value.Clone(allocator_);
+
+    // Shares the storage.
+    if (*value.get_allocator().resource() == *allocator_.resource())
+      return value.Clone(allocator_);
+
+    if (value.IsArray())
+      return Value(CloneArray(value.GetArray()));
+    return Value(CloneObject(value.GetObject()));
+  }
+
+ private:
+  Value::Array CloneArray(const Value::Array& array) {
+    Value::Array result(allocator_);
+    if (array.size() < kMinParallelSize) {
+      result.reserve(array.size());
+      for (const auto& element : array)
+        result.emplace_back(Clone(element));
+      return result;
+    }
+
+    result.resize(array.size());
+    CloneInParallel(array.size(), [this, &array, &result](const size_t i) {
+      result[i] = array[i].Clone(allocator_);
+    });
+    return result;
+  }
+
+  Value::Object CloneObject(const Value::Object& object) {
+    Value::Object result(allocator_);
+    result.reserve(object.size());
+    if (object.size() < kMinParallelSize) {
+      for (const auto& [key, member] : object)
+        result.try_emplace(result.cend(), key, Clone(member));
+      return result;
+    }
+
+    for (const auto& [key, member] : object)
+      result.try_emplace(result.cend(), key, Value());
+
+    CloneInParallel(object.size(), [this, &object, &result](const size_t i) {
+      (result.begin() + static_cast<ptrdiff_t>(i))->second =
+          (object.cbegin() + static_cast<ptrdiff_t>(i))->second.Clone(
+              allocator_);
+    });
+    return result;
+  }
+
+  // Calls |clone| for every index below |size| in |parallelism_| segments.
+  void CloneInParallel(const size_t size,
+                       const std::function<void(size_t)>& clone) {
+    const auto segments = std::min(parallelism_, size);
+    task_runner_.ApplyTaskSync(
+        [size, segments, &clone](const size_t segment) {
+          const auto begin = size * segment / segments;
+          const auto end = size * (segment + 1) / segments;
+          for (auto i = begin; i < end; i++)
+            clone(i);
+        },
+        segments);
+  }
+
+  TaskRunner& task_runner_;
+  const size_t parallelism_;
+  const Value::allocator_type allocator_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ParallelCloner);
+};
+
+}  // namespace
+
+Value ParallelClone(const Value& value, const NotNull<TaskRunner*> task_runner,
+                    const ValueCloneParallelism parallelism,
+                    const Value::allocator_type& allocator) {
+  ParallelCloner cloner(task_runner, parallelism, allocator);
+  return cloner.Clone(value);
+}
+
+void DeleteSoon(Value&& value, const NotNull<TaskRunner*> task_runner) {
+  // Scalars don't own memory.
+  if (!value.IsString() && !value.IsArray() && !value.IsObject())
+    return;
+
+  // std::function must be copyable.
+  task_runner->PostTask(
+      [value = std::make_shared<Value>(std::move(value))]() mutable {
+        value.reset();
+      });
+}
+
+}  // namespace rst
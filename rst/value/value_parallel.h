@@ -0,0 +1,86 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_VALUE_PARALLEL_H_
+#define RST_VALUE_VALUE_PARALLEL_H_
+
+#include <cstddef>
+
+#include "rst/not_null/not_null.h"
+#include "rst/task_runner/task_runner.h"
+#include "rst/type/type.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+// Number of segments the elements of a large array or object are split into
+// to be cloned in parallel.
+using ValueCloneParallelism = Type<class ValueCloneParallelismTag, size_t>;
+
+// Like `rst::Value::Clone()` but clones the elements of large arrays and
+// objects on |task_runner| in |parallelism| segments and waits for them.
+// Smaller containers are walked on the calling thread to reach the large ones
+// inside. Keys of objects are copied on the calling thread. Storage that
+// already uses the memory resource of |allocator| is shared as with
+// `rst::Value::Clone()`, so parallelism helps only when copying into another
+// resource. The resource of |allocator| must be thread-safe, e.g. the default
+// one, so `rst::ValueArena` can't be the target.
+//
+// Example:
+//
+//   #include "rst/value/value_parallel.h"
+//
+//   rst::ValueArena arena;
+//   rst::NotNull<rst::Value*> value = arena.New(...);
+//   ...
+//   rst::ThreadPoolTaskRunner task_runner(8, std::chrono::seconds(60));
+//   rst::Value copy = rst::ParallelClone(*value, &task_runner,
+//                                        rst::ValueCloneParallelism(8));
+//
+Value ParallelClone(const Value& value, NotNull<TaskRunner*> task_runner,
+                    ValueCloneParallelism parallelism,
+                    const Value::allocator_type& allocator =
+                        Value::allocator_type());
+
+// Moves |value| to a task posted to |task_runner| that destroys it, so that the
+// caller doesn't pay for freeing a large tree. If the storage of |value| is
+// shared with clones, the task only releases its reference. The memory
+// resource of |value| must be thread-safe and outlive the task.
+//
+// Example:
+//
+//   #include "rst/value/value_parallel.h"
+//
+//   rst::Value response = ...;
+//   Send(response);
+//   rst::DeleteSoon(std::move(response), &background_task_runner);
+//
+void DeleteSoon(Value&& value, NotNull<TaskRunner*> task_runner);
+
+}  // namespace rst
+
+#endif  // RST_VALUE_VALUE_PARALLEL_H_
@@ -0,0 +1,126 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_parallel.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "rst/memory/tracking_memory_resource.h"
+#include "rst/task_runner/polling_task_runner.h"
+#include "rst/task_runner/thread_pool_task_runner.h"
+#include "rst/value/value_arena.h"
+
+namespace chrono = std::chrono;
+
+namespace rst {
+namespace {
+
+// Makes an object with a large array and a large object inside of a small
+// array.
+Value MakeTree(const Value::allocator_type& allocator) {
+  Value array(std::allocator_arg, allocator, Value::Type::kArray);
+  Value object(std::allocator_arg, allocator, Value::Type::kObject);
+  for (auto i = 0; i < 1500; i++) {
+    Value element(std::allocator_arg, allocator, Value::Type::kObject);
+    element.SetKey("id", Value(i));
+    element.SetKey("name", Value(std::to_string(i)));
+    array.GetArray().emplace_back(std::move(element));
+    object.SetKey(std::to_string(i), Value(std::to_string(i)));
+  }
+
+  Value small(std::allocator_arg, allocator, Value::Type::kArray);
+  small.GetArray().emplace_back(std::move(array));
+  small.GetArray().emplace_back(std::move(object));
+  small.GetArray().emplace_back("string");
+
+  Value root(std::allocator_arg, allocator, Value::Type::kObject);
+  root.SetKey("small", std::move(small));
+  root.SetKey("number", Value(1.5));
+  return root;
+}
+
+}  // namespace
+
+TEST(ParallelClone, CopiesIntoAnotherResource) {
+  ValueArena arena;
+  const auto value = MakeTree(arena.allocator());
+
+  ThreadPoolTaskRunner task_runner(4, chrono::seconds(60));
+  for (size_t parallelism = 1; parallelism <= 8; parallelism *= 2) {
+    TrackingMemoryResource resource;
+    {
+      const auto clone = ParallelClone(
+          value, &task_runner, ValueCloneParallelism(parallelism), &resource);
+      EXPECT_EQ(clone, value);
+      EXPECT_FALSE(clone.SharesStorageWith(value));
+      EXPECT_EQ(clone.get_allocator(), Value::allocator_type(&resource));
+      EXPECT_EQ(clone.Hash(), value.Hash());
+      EXPECT_GT(resource.allocated_bytes(), 0U);
+    }
+    EXPECT_EQ(resource.allocated_bytes(), 0U);
+  }
+}
+
+TEST(ParallelClone, SharesWithinResource) {
+  const auto value = MakeTree(Value::allocator_type());
+  ThreadPoolTaskRunner task_runner(2, chrono::seconds(60));
+  const auto clone =
+      ParallelClone(value, &task_runner, ValueCloneParallelism(2));
+  EXPECT_TRUE(clone.SharesStorageWith(value));
+
+  EXPECT_EQ(ParallelClone(Value(1), &task_runner, ValueCloneParallelism(2)),
+            Value(1));
+}
+
+TEST(DeleteSoon, DestroysOnTaskRunner) {
+  PollingTaskRunner task_runner(
+      []() -> chrono::nanoseconds { return chrono::nanoseconds(0); });
+  TrackingMemoryResource resource;
+
+  auto value = MakeTree(&resource);
+  DeleteSoon(std::move(value), &task_runner);
+  EXPECT_GT(resource.allocated_bytes(), 0U);
+
+  task_runner.RunPendingTasks();
+  EXPECT_EQ(resource.allocated_bytes(), 0U);
+
+  auto clone = MakeTree(&resource);
+  const auto original = clone.Clone(&resource);
+  const auto bytes = resource.allocated_bytes();
+  DeleteSoon(std::move(clone), &task_runner);
+  task_runner.RunPendingTasks();
+  EXPECT_EQ(resource.allocated_bytes(), bytes);
+
+  DeleteSoon(Value(1), &task_runner);
+  task_runner.RunPendingTasks();
+}
+
+}  // namespace rst
@@ -0,0 +1,652 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_query.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <functional>
+#include <system_error>
+#include <utility>
+
+#include "rst/check/check.h"
+#include "rst/status/status_macros.h"
+#include "rst/strings/str_cat.h"
+#include "rst/value/json_reader.h"
+
+namespace rst {
+namespace {
+
+// Limits the recursion of the expression parser.
+constexpr size_t kMaxExpressionDepth = 100;
+
+constexpr bool IsWhitespace(const char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+constexpr bool IsDigit(const char c) { return c >= '0' && c <= '9'; }
+
+// Returns true if |c| can start a member name shorthand, e.g. `.key`.
+constexpr bool IsNameFirstChar(const char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+         static_cast<unsigned char>(c) >= 0x80;
+}
+
+constexpr bool IsNameChar(const char c) {
+  return IsNameFirstChar(c) || IsDigit(c);
+}
+
+// Calls |function| for every element of an array or member of an object.
+template <class Function>
+void ForEachChild(const Value& value, Function&& function) {
+  if (value.IsArray()) {
+    for (const auto& element : value.GetArray())
+      function(element);
+  } else if (value.IsObject()) {
+    for (const auto& [key, member] : value.GetObject())
+      function(member);
+  }
+}
+
+}  // namespace
+
+struct ValueQuery::Selector {
+  enum class Kind {
+    kKey,
+    kIndex,
+    kWildcard,
+    kFilter,
+  };
+
+  Kind kind = Kind::kWildcard;
+  std::string key;
+  // Negative indices count from the end of an array.
+  int64_t index = 0;
+  // The root node of the filter expression.
+  size_t expression = 0;
+};
+
+struct ValueQuery::Expression {
+  enum class Kind {
+    kOr,
+    kAnd,
+    kNot,
+    kExists,
+    kCompare,
+  };
+
+  enum class Operator {
+    kEqual,
+    kNotEqual,
+    kLess,
+    kLessOrEqual,
+    kGreater,
+    kGreaterOrEqual,
+  };
+
+  Kind kind = Kind::kExists;
+  // Operands of kOr, kAnd and kNot.
+  size_t lhs = 0;
+  size_t rhs = 0;
+  // The relative path of kExists and kCompare, only keys and indices.
+  std::vector<Selector> path;
+  Operator op = Operator::kEqual;
+  Value literal;
+};
+
+class ValueQuery::Parser {
+ public:
+  Parser(const std::string_view query, const NotNull<ValueQuery*> plan)
+      : query_(query), plan_(*plan) {}
+
+  Status Parse() {
+    SkipWhitespace();
+    if (!Consume('$'))
+      return MakeError("Expected '$'");
+
+    while (true) {
+      SkipWhitespace();
+      if (offset_ == query_.size())
+        return Status::OK();
+      if (!ParseSegment(&plan_.selectors_))
+        return MakeError(error_message_);
+    }
+  }
+
+ private:
+  bool ParseSegment(const NotNull<std::vector<Selector>*> selectors) {
+    if (Consume('.')) {
+      Selector selector;
+      if (Consume('*')) {
+        selector.kind = Selector::Kind::kWildcard;
+      } else {
+        selector.kind = Selector::Kind::kKey;
+        if (!ParseName(&selector.key))
+          return false;
+      }
+
+      selectors->emplace_back(std::move(selector));
+      return true;
+    }
+
+    if (Consume('['))
+      return ParseBracket(selectors);
+
+    return Fail("Expected '.' or '['");
+  }
+
+  bool ParseBracket(const NotNull<std::vector<Selector>*> selectors) {
+    SkipWhitespace();
+    if (offset_ == query_.size())
+      return Fail("Unexpected end of query");
+
+    Selector selector;
+    const auto c = query_[offset_];
+    if (c == '*') {
+      offset_++;
+      selector.kind = Selector::Kind::kWildcard;
+    } else if (c == '?') {
+      offset_++;
+      selector.kind = Selector::Kind::kFilter;
+      if (!ParseOr(&selector.expression, 0))
+        return false;
+    } else if (c == '\'' || c == '"') {
+      selector.kind = Selector::Kind::kKey;
+      if (!ParseQuoted(&selector.key))
+        return false;
+    } else {
+      selector.kind = Selector::Kind::kIndex;
+      if (!ParseIndex(&selector.index))
+        return false;
+    }
+
+    SkipWhitespace();
+    if (!Consume(']'))
+      return Fail("Expected ']'");
+
+    selectors->emplace_back(std::move(selector));
+    return true;
+  }
+
+  bool ParseName(const NotNull<std::string*> name) {
+    const auto begin = offset_;
+    if (offset_ == query_.size() || !IsNameFirstChar(query_[offset_]))
+      return Fail("Expected name");
+
+    while (offset_ != query_.size() && IsNameChar(query_[offset_]))
+      offset_++;
+
+    *name = query_.substr(begin, offset_ - begin);
+    return true;
+  }
+
+  // Parses a string in single quotes as is or in double quotes as JSON.
+  bool ParseQuoted(const NotNull<std::string*> string) {
+    if (query_[offset_] == '"') {
+      Value value;
+      if (!ParseLiteral(&value))
+        return false;
+      *string = value.GetString();
+      return true;
+    }
+
+    offset_++;  // '\''.
+    const auto end = query_.find('\'', offset_);
+    if (end == std::string_view::npos) {
+      offset_ = query_.size();
+      return Fail("Unterminated string");
+    }
+
+    *string = query_.substr(offset_, end - offset_);
+    offset_ = end + 1;
+    return true;
+  }
+
+  bool ParseIndex(const NotNull<int64_t*> index) {
+    const auto begin = query_.data() + offset_;
+    const auto end = query_.data() + query_.size();
+    const auto [ptr, ec] = std::from_chars(begin, end, *index);
+    if (ec != std::errc() || ptr == begin)
+      return Fail("Expected index");
+
+    offset_ += static_cast<size_t>(ptr - begin);
+    return true;
+  }
+
+  // Parses a JSON scalar.
+  bool ParseLiteral(const NotNull<Value*> value) {
+    SkipWhitespace();
+    if (offset_ != query_.size() && query_[offset_] == '\'') {
+      std::string string;
+      if (!ParseQuoted(&string))
+        return false;
+      *value = Value(string);
+      return true;
+    }
+
+    if (offset_ == query_.size() || query_[offset_] == '[' ||
+        query_[offset_] == '{') {
+      return Fail("Expected literal");
+    }
+
+    size_t end = 0;
+    auto status = internal::ParseJsonValue(query_, offset_, 0, JsonMaxDepth(1),
+                                           value, &end);
+    if (status.err())
+      return Fail("Invalid literal");
+
+    offset_ = end;
+    return true;
+  }
+
+  bool ParseOr(const NotNull<size_t*> node, const size_t depth) {
+    if (depth == kMaxExpressionDepth)
+      return Fail("Too deep nesting");
+
+    if (!ParseAnd(node, depth))
+      return false;
+
+    while (ConsumeOperator("||")) {
+      size_t rhs = 0;
+      if (!ParseAnd(&rhs, depth))
+        return false;
+      *node = AddBinary(Expression::Kind::kOr, *node, rhs);
+    }
+
+    return true;
+  }
+
+  bool ParseAnd(const NotNull<size_t*> node, const size_t depth) {
+    if (!ParseUnary(node, depth))
+      return false;
+
+    while (ConsumeOperator("&&")) {
+      size_t rhs = 0;
+      if (!ParseUnary(&rhs, depth))
+        return false;
+      *node = AddBinary(Expression::Kind::kAnd, *node, rhs);
+    }
+
+    return true;
+  }
+
+  bool ParseUnary(const NotNull<size_t*> node, const size_t depth) {
+    SkipWhitespace();
+    if (offset_ != query_.size() && query_[offset_] == '!' &&
+        query_.compare(offset_, 2, "!=") != 0) {
+      if (depth == kMaxExpressionDepth)
+        return Fail("Too deep nesting");
+      offset_++;
+
+      size_t operand = 0;
+      if (!ParseUnary(&operand, depth + 1))
+        return false;
+      *node = AddBinary(Expression::Kind::kNot, operand, 0);
+      return true;
+    }
+
+    return ParsePrimary(node, depth);
+  }
+
+  bool ParsePrimary(const NotNull<size_t*> node, const size_t depth) {
+    SkipWhitespace();
+    if (Consume('(')) {
+      if (!ParseOr(node, depth + 1))
+        return false;
+
+      SkipWhitespace();
+      if (!Consume(')'))
+        return Fail("Expected ')'");
+      return true;
+    }
+
+    if (!Consume('@'))
+      return Fail("Expected '@' or '('");
+
+    Expression expression;
+    while (true) {
+      SkipWhitespace();
+      if (offset_ == query_.size() ||
+          (query_[offset_] != '.' && query_[offset_] != '[')) {
+        break;
+      }
+
+      const auto selector_offset = offset_;
+      if (!ParseSegment(&expression.path))
+        return false;
+
+      const auto kind = expression.path.back().kind;
+      if (kind != Selector::Kind::kKey && kind != Selector::Kind::kIndex) {
+        offset_ = selector_offset;
+        return Fail("Expected key or index");
+      }
+    }
+
+    expression.kind = Expression::Kind::kCompare;
+    if (ConsumeOperator("==")) {
+      expression.op = Expression::Operator::kEqual;
+    } else if (ConsumeOperator("!=")) {
+      expression.op = Expression::Operator::kNotEqual;
+    } else if (ConsumeOperator("<=")) {
+      expression.op = Expression::Operator::kLessOrEqual;
+    } else if (ConsumeOperator(">=")) {
+      expression.op = Expression::Operator::kGreaterOrEqual;
+    } else if (ConsumeOperator("<")) {
+      expression.op = Expression::Operator::kLess;
+    } else if (ConsumeOperator(">")) {
+      expression.op = Expression::Operator::kGreater;
+    } else {
+      expression.kind = Expression::Kind::kExists;
+    }
+
+    if (expression.kind == Expression::Kind::kCompare &&
+        !ParseLiteral(&expression.literal)) {
+      return false;
+    }
+
+    *node = plan_.expressions_.size();
+    plan_.expressions_.emplace_back(std::move(expression));
+    return true;
+  }
+
+  size_t AddBinary(const Expression::Kind kind, const size_t lhs,
+                   const size_t rhs) {
+    Expression expression;
+    expression.kind = kind;
+    expression.lhs = lhs;
+    expression.rhs = rhs;
+    plan_.expressions_.emplace_back(std::move(expression));
+    return plan_.expressions_.size() - 1;
+  }
+
+  void SkipWhitespace() {
+    while (offset_ != query_.size() && IsWhitespace(query_[offset_]))
+      offset_++;
+  }
+
+  // Skips |c| if it's the current character.
+  bool Consume(const char c) {
+    if (offset_ == query_.size() || query_[offset_] != c)
+      return false;
+
+    offset_++;
+    return true;
+  }
+
+  // Skips whitespace and |op| if it follows.
+  bool ConsumeOperator(const std::string_view op) {
+    SkipWhitespace();
+    if (query_.substr(offset_, op.size()) != op)
+      return false;
+
+    offset_ += op.size();
+    return true;
+  }
+
+  bool Fail(const std::string_view message) {
+    error_message_ = message;
+    return false;
+  }
+
+  Status MakeError(const std::string_view message) const {
+    return MakeStatus<ValueQueryError>(message, offset_);
+  }
+
+  const std::string_view query_;
+  ValueQuery& plan_;
+  size_t offset_ = 0;
+  std::string_view error_message_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(Parser);
+};
+
+class ValueQuery::Evaluator {
+ public:
+  // Stores the values reached after the selectors before |end| in |out|.
+  Evaluator(const ValueQuery& query, const size_t end,
+            const NotNull<std::vector<NotNull<const Value*>>*> out)
+      : query_(query), end_(end), out_(out) {
+    RST_DCHECK(end <= query.selectors_.size());
+  }
+
+  // Applies the selectors starting from |selector| to |value|.
+  void Evaluate(const size_t selector, const Value& value) {
+    if (selector == end_) {
+      out_->emplace_back(&value);
+      return;
+    }
+
+    const auto& current = query_.selectors_[selector];
+    switch (current.kind) {
+      case Selector::Kind::kKey:
+      case Selector::Kind::kIndex: {
+        const auto child = Select(current, value);
+        if (child != nullptr)
+          Evaluate(selector + 1, *child);
+        return;
+      }
+      case Selector::Kind::kWildcard:
+      case Selector::Kind::kFilter:
+        ForEachChild(value, [this, selector](const Value& child) {
+          EvaluateChild(selector, child);
+        });
+        return;
+    }
+
+    RST_NOTREACHED();
+  }
+
+  // Applies the wildcard or the filter |selector| to an element or a member
+  // |child| and continues with the next selectors if it matches.
+  void EvaluateChild(const size_t selector, const Value& child) {
+    const auto& current = query_.selectors_[selector];
+    RST_DCHECK(current.kind == Selector::Kind::kWildcard ||
+               current.kind == Selector::Kind::kFilter);
+    if (current.kind == Selector::Kind::kFilter &&
+        !Test(current.expression, child)) {
+      return;
+    }
+
+    Evaluate(selector + 1, child);
+  }
+
+ private:
+  bool Test(const size_t node, const Value& value) const {
+    const auto& expression = query_.expressions_[node];
+    switch (expression.kind) {
+      case Expression::Kind::kOr:
+        return Test(expression.lhs, value) || Test(expression.rhs, value);
+      case Expression::Kind::kAnd:
+        return Test(expression.lhs, value) && Test(expression.rhs, value);
+      case Expression::Kind::kNot:
+        return !Test(expression.lhs, value);
+      case Expression::Kind::kExists:
+        return Find(expression.path, value) != nullptr;
+      case Expression::Kind::kCompare: {
+        const auto target = Find(expression.path, value);
+        if (target == nullptr)
+          return expression.op == Expression::Operator::kNotEqual;
+        return Compare(*target, expression.op, expression.literal);
+      }
+    }
+
+    RST_NOTREACHED();
+    return false;
+  }
+
+  static bool Compare(const Value& lhs, const Expression::Operator op,
+                      const Value& rhs) {
+    if (lhs.type() != rhs.type())
+      return op == Expression::Operator::kNotEqual;
+
+    const auto is_ordered = lhs.IsNumber() || lhs.IsString();
+    switch (op) {
+      case Expression::Operator::kEqual:
+        return lhs == rhs;
+      case Expression::Operator::kNotEqual:
+        return lhs != rhs;
+      case Expression::Operator::kLess:
+        return is_ordered && lhs < rhs;
+      case Expression::Operator::kLessOrEqual:
+        return is_ordered && (lhs < rhs || lhs == rhs);
+      case Expression::Operator::kGreater:
+        return is_ordered && rhs < lhs;
+      case Expression::Operator::kGreaterOrEqual:
+        return is_ordered && (rhs < lhs || lhs == rhs);
+    }
+
+    RST_NOTREACHED();
+    return false;
+  }
+
+  static Nullable<const Value*> Find(const std::vector<Selector>& path,
+                                     const Value& value) {
+    const Value* current = &value;
+    for (const auto& selector : path) {
+      const auto child = Select(selector, *current);
+      if (child == nullptr)
+        return nullptr;
+      current = child.get();
+    }
+
+    return current;
+  }
+
+  static Nullable<const Value*> Select(const Selector& selector,
+                                       const Value& value) {
+    if (selector.kind == Selector::Kind::kKey) {
+      if (!value.IsObject())
+        return nullptr;
+      return value.FindKey(selector.key);
+    }
+
+    RST_DCHECK(selector.kind == Selector::Kind::kIndex);
+    if (!value.IsArray())
+      return nullptr;
+
+    const auto& array = value.GetArray();
+    const auto size = static_cast<int64_t>(array.size());
+    const auto index = selector.index < 0 ? size + selector.index
+                                          : selector.index;
+    if (index < 0 || index >= size)
+      return nullptr;
+    return &array[static_cast<size_t>(index)];
+  }
+
+  const ValueQuery& query_;
+  const size_t end_;
+  const NotNull<std::vector<NotNull<const Value*>>*> out_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(Evaluator);
+};
+
+char ValueQueryError::id_ = '\0';
+
+ValueQueryError::ValueQueryError(const std::string_view message,
+                                 const size_t offset)
+    : message_(StrCat({message, " at offset ", offset})), offset_(offset) {}
+
+ValueQueryError::~ValueQueryError() = default;
+
+const std::string& ValueQueryError::AsString() const { return message_; }
+
+ValueQuery::ValueQuery() = default;
+
+ValueQuery::~ValueQuery() = default;
+
+ValueQuery::ValueQuery(ValueQuery&&) noexcept = default;
+
+ValueQuery& ValueQuery::operator=(ValueQuery&&) noexcept = default;
+
+StatusOr<ValueQuery> ValueQuery::Compile(const std::string_view query) {
+  ValueQuery plan;
+  plan.query_ = query;
+  Parser parser(query, &plan);
+  RST_TRY(parser.Parse());
+  return plan;
+}
+
+std::vector<NotNull<const Value*>> ValueQuery::Evaluate(
+    const Value& value) const {
+  std::vector<NotNull<const Value*>> result;
+  Evaluator evaluator(*this, selectors_.size(), &result);
+  evaluator.Evaluate(0, value);
+  return result;
+}
+
+std::vector<NotNull<const Value*>> ValueQuery::Evaluate(
+    const Value& value, const NotNull<TaskRunner*> task_runner,
+    const ValueQueryParallelism parallelism) const {
+  RST_DCHECK(parallelism.value() > 0);
+
+  const auto it = std::find_if(
+      selectors_.cbegin(), selectors_.cend(), [](const Selector& selector) {
+        return selector.kind == Selector::Kind::kWildcard ||
+               selector.kind == Selector::Kind::kFilter;
+      });
+  if (it == selectors_.cend())
+    return Evaluate(value);
+  const auto fan_out = static_cast<size_t>(it - selectors_.cbegin());
+
+  // Values that the first wildcard or filter applies to.
+  std::vector<NotNull<const Value*>> parents;
+  Evaluator parents_evaluator(*this, fan_out, &parents);
+  parents_evaluator.Evaluate(0, value);
+
+  std::vector<NotNull<const Value*>> children;
+  for (const auto& parent : parents) {
+    ForEachChild(*parent, [&children](const Value& child) {
+      children.emplace_back(&child);
+    });
+  }
+
+  const auto segments = std::min(parallelism.value(), children.size());
+  if (segments == 0)
+    return {};
+
+  std::vector<std::vector<NotNull<const Value*>>> results(segments);
+  task_runner->ApplyTaskSync(
+      [this, fan_out, segments, &children, &results](const size_t segment) {
+        const auto begin = children.size() * segment / segments;
+        const auto end = children.size() * (segment + 1) / segments;
+        Evaluator evaluator(*this, selectors_.size(), &results[segment]);
+        for (auto i = begin; i < end; i++)
+          evaluator.EvaluateChild(fan_out, *children[i]);
+      },
+      segments);
+
+  std::vector<NotNull<const Value*>> result;
+  for (auto& segment_result : results) {
+    result.insert(result.end(), segment_result.cbegin(),
+                  segment_result.cend());
+  }
+
+  return result;
+}
+
+}  // namespace rst
@@ -0,0 +1,148 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_VALUE_QUERY_H_
+#define RST_VALUE_VALUE_QUERY_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rst/macros/macros.h"
+#include "rst/not_null/not_null.h"
+#include "rst/status/status.h"
+#include "rst/status/status_or.h"
+#include "rst/task_runner/task_runner.h"
+#include "rst/type/type.h"
+#include "rst/value/value.h"
+
+namespace rst {
+
+class ValueQueryError final : public ErrorInfo<ValueQueryError> {
+ public:
+  ValueQueryError(std::string_view message, size_t offset);
+  ~ValueQueryError() override;
+
+  // ErrorInfo:
+  const std::string& AsString() const override;
+
+  // Returns the byte offset in the query where the error has been detected.
+  size_t offset() const { return offset_; }
+
+  static char id_;
+
+ private:
+  const std::string message_;
+  const size_t offset_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ValueQueryError);
+};
+
+// Number of segments the elements of a large array are split into to be
+// evaluated in parallel.
+using ValueQueryParallelism = Type<class ValueQueryParallelismTag, size_t>;
+
+// A query over `rst::Value` in a subset of JSONPath (RFC 9535), compiled once
+// into a plan and evaluated many times. A query starts with `$`, the root,
+// followed by segments:
+//
+//   .key, ['key'], ["key"]  The member of an object.
+//   [1], [-1]               The element of an array, negative from the end.
+//   .*, [*]                 All the elements of an array or the members of an
+//                           object.
+//   [?expression]           The elements or members for which |expression| is
+//                           true.
+//
+// An expression compares a path relative to the current element, `@` followed
+// by keys and indices, with a literal: a JSON number, a string in single or
+// double quotes, true, false or null. The operators are ==, !=, <, <=, >, >=.
+// A path alone tests that it exists. Expressions are combined with !, && and
+// || and grouped with parentheses. Numbers are compared by value, strings
+// lexicographically, bools and nulls only by equality. A comparison with a
+// missing value or a value of another type is false, except for !=.
+//
+// Evaluation returns pointers to the matching values in document order, which
+// are valid while the evaluated value is not modified.
+//
+// Example:
+//
+//   #include "rst/value/value_query.h"
+//
+//   rst::StatusOr<rst::ValueQuery> query =
+//       rst::ValueQuery::Compile("$.items[?@.qty > 10].price");
+//   if (query.err())
+//     return std::move(query).TakeStatus();
+//
+//   const rst::Value& order = ...;
+//   std::vector<rst::NotNull<const rst::Value*>> prices =
+//       query->Evaluate(order);
+//
+class ValueQuery {
+ public:
+  ~ValueQuery();
+
+  ValueQuery(ValueQuery&&) noexcept;
+  ValueQuery& operator=(ValueQuery&&) noexcept;
+
+  // Parses |query| into a plan. Returns `rst::ValueQueryError` with the offset
+  // of the syntax error.
+  static StatusOr<ValueQuery> Compile(std::string_view query);
+
+  // Returns the values of |value| that match the query.
+  std::vector<NotNull<const Value*>> Evaluate(const Value& value) const;
+
+  // Like the function above but splits the elements of the arrays and objects
+  // at the first wildcard or filter into |parallelism| segments that are
+  // evaluated concurrently on |task_runner|. Must not be called from a thread
+  // of |task_runner|.
+  std::vector<NotNull<const Value*>> Evaluate(
+      const Value& value, NotNull<TaskRunner*> task_runner,
+      ValueQueryParallelism parallelism) const;
+
+  // Returns the source of the query.
+  const std::string& query() const { return query_; }
+
+ private:
+  struct Selector;
+  struct Expression;
+  class Parser;
+  class Evaluator;
+
+  ValueQuery();
+
+  std::string query_;
+  std::vector<Selector> selectors_;
+  // Nodes of the filter expressions referenced by the selectors.
+  std::vector<Expression> expressions_;
+
+  RST_DISALLOW_COPY_AND_ASSIGN(ValueQuery);
+};
+
+}  // namespace rst
+
+#endif  // RST_VALUE_VALUE_QUERY_H_
@@ -0,0 +1,207 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "rst/value/value_query.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rst/strings/str_cat.h"
+#include "rst/task_runner/thread_pool_task_runner.h"
+#include "rst/value/value_test_util.h"
+
+namespace chrono = std::chrono;
+
+namespace rst {
+namespace {
+
+// Returns the query results as a JSON array.
+Value Query(const std::string_view query, const Value& value) {
+  auto plan = ValueQuery::Compile(query);
+  RST_CHECK(!plan.err());
+
+  Value result(Value::Type::kArray);
+  for (const auto& element : plan->Evaluate(value))
+    result.GetArray().emplace_back(element->Clone());
+  return result;
+}
+
+size_t ErrorOffset(const std::string_view query) {
+  return GetErrorOffset<ValueQueryError>(ValueQuery::Compile(query));
+}
+
+}  // namespace
+
+TEST(ValueQuery, Paths) {
+  const auto value = ParseJsonOrDie(R"({
+    "a": {"b": [10, 20, 30], "c d": true},
+    "e": [{"f": 1}, {"f": 2}, {"g": 3}]
+  })");
+
+  EXPECT_EQ(Query("$", value), ParseJsonOrDie(R"([)" R"(
+    {"a": {"b": [10, 20, 30], "c d": true},
+     "e": [{"f": 1}, {"f": 2}, {"g": 3}]}])"));
+  EXPECT_EQ(Query("$.a.b", value), ParseJsonOrDie("[[10, 20, 30]]"));
+  EXPECT_EQ(Query("$.a.b[1]", value), ParseJsonOrDie("[20]"));
+  EXPECT_EQ(Query("$.a.b[-1]", value), ParseJsonOrDie("[30]"));
+  EXPECT_EQ(Query("$.a.b[3]", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$.a.b[-4]", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$['a'][\"c d\"]", value), ParseJsonOrDie("[true]"));
+  EXPECT_EQ(Query("$[ 'a' ] [ 'b' ] [ 0 ]", value), ParseJsonOrDie("[10]"));
+  EXPECT_EQ(Query("$.a.missing", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$.a.b.c", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$.a[0]", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$.e[*].f", value), ParseJsonOrDie("[1, 2]"));
+  EXPECT_EQ(Query("$.a.*", value),
+            ParseJsonOrDie("[[10, 20, 30], true]"));
+  EXPECT_EQ(Query("$.a.b.*.*", value), ParseJsonOrDie("[]"));
+}
+
+TEST(ValueQuery, Filters) {
+  const auto value = ParseJsonOrDie(R"([
+    {"name": "a", "qty": 5, "price": 1.5, "tags": ["x"]},
+    {"name": "b", "qty": 15, "price": 2.5, "ok": true},
+    {"name": "c", "qty": 25, "price": 3.5, "ok": false},
+    {"name": "d", "price": 4.5, "ok": null}
+  ])");
+
+  EXPECT_EQ(Query("$[?@.qty > 10].name", value),
+            ParseJsonOrDie(R"(["b", "c"])"));
+  EXPECT_EQ(Query("$[?@.qty >= 15].name", value),
+            ParseJsonOrDie(R"(["b", "c"])"));
+  EXPECT_EQ(Query("$[?@.qty < 15].name", value),
+            ParseJsonOrDie(R"(["a"])"));
+  EXPECT_EQ(Query("$[?@.qty <= 15].name", value),
+            ParseJsonOrDie(R"(["a", "b"])"));
+  EXPECT_EQ(Query("$[?@.qty == 15.0].name", value),
+            ParseJsonOrDie(R"(["b"])"));
+  EXPECT_EQ(Query("$[?@.qty != 15].name", value),
+            ParseJsonOrDie(R"(["a", "c", "d"])"));
+  EXPECT_EQ(Query("$[?@.name == 'c'].qty", value), ParseJsonOrDie("[25]"));
+  EXPECT_EQ(Query("$[?@.name >= \"b\"].qty", value),
+            ParseJsonOrDie("[15, 25]"));
+  EXPECT_EQ(Query("$[?@.ok == true].name", value),
+            ParseJsonOrDie(R"(["b"])"));
+  EXPECT_EQ(Query("$[?@.ok == null].name", value),
+            ParseJsonOrDie(R"(["d"])"));
+  EXPECT_EQ(Query("$[?@.ok < true].name", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$[?@.name > 1].name", value), ParseJsonOrDie("[]"));
+  EXPECT_EQ(Query("$[?@.ok].name", value),
+            ParseJsonOrDie(R"(["b", "c", "d"])"));
+  EXPECT_EQ(Query("$[?!@.ok].name", value), ParseJsonOrDie(R"(["a"])"));
+  EXPECT_EQ(Query("$[?@.tags[0] == 'x'].name", value),
+            ParseJsonOrDie(R"(["a"])"));
+  EXPECT_EQ(Query("$[?@.qty > 10 && @.ok == false].name", value),
+            ParseJsonOrDie(R"(["c"])"));
+  EXPECT_EQ(Query("$[?@.qty < 10 || @.price > 4].name", value),
+            ParseJsonOrDie(R"(["a", "d"])"));
+  EXPECT_EQ(Query("$[?@.qty < 10 || @.qty > 20 && @.ok == false].name", value),
+            ParseJsonOrDie(R"(["a", "c"])"));
+  EXPECT_EQ(
+      Query("$[?(@.qty < 10 || @.qty > 20) && !(@.name == 'a')].name", value),
+      ParseJsonOrDie(R"(["c"])"));
+  EXPECT_EQ(Query("$[?@ == 5]", ParseJsonOrDie("[5, 6, 5]")),
+            ParseJsonOrDie("[5, 5]"));
+  EXPECT_EQ(Query("$.*[?@ > 1]", ParseJsonOrDie(R"({"a": [1, 2], "b": [3]})")),
+            ParseJsonOrDie("[2, 3]"));
+}
+
+TEST(ValueQuery, Errors) {
+  EXPECT_EQ(ErrorOffset(""), 0U);
+  EXPECT_EQ(ErrorOffset("a"), 0U);
+  EXPECT_EQ(ErrorOffset("$a"), 1U);
+  EXPECT_EQ(ErrorOffset("$."), 2U);
+  EXPECT_EQ(ErrorOffset("$.1"), 2U);
+  EXPECT_EQ(ErrorOffset("$["), 2U);
+  EXPECT_EQ(ErrorOffset("$[1"), 3U);
+  EXPECT_EQ(ErrorOffset("$[x]"), 2U);
+  EXPECT_EQ(ErrorOffset("$['a"), 4U);
+  EXPECT_EQ(ErrorOffset("$[?]"), 3U);
+  EXPECT_EQ(ErrorOffset("$[?@.a >]"), 8U);
+  EXPECT_EQ(ErrorOffset("$[?@.a > x]"), 9U);
+  EXPECT_EQ(ErrorOffset("$[?@.a > [1]]"), 9U);
+  EXPECT_EQ(ErrorOffset("$[?@.a[*]]"), 6U);
+  EXPECT_EQ(ErrorOffset("$[?(@.a]"), 7U);
+  EXPECT_EQ(ErrorOffset("$[?@.a &&]"), 9U);
+  EXPECT_EQ(ErrorOffset("$[?!=@.a]"), 3U);
+  EXPECT_EQ(ErrorOffset("$[?@.a && !=@.b]"), 10U);
+  EXPECT_EQ(ErrorOffset("$[?!!=@.a]"), 4U);
+  EXPECT_EQ(ErrorOffset(StrCat({"$[?", std::string(200, '('), "@)]"})),
+            103U);
+  EXPECT_EQ(ErrorOffset(StrCat({"$[?", std::string(200, '!'), "@]"})), 103U);
+
+  auto plan = ValueQuery::Compile("$.a");
+  ASSERT_FALSE(plan.err());
+  EXPECT_EQ(plan->query(), "$.a");
+}
+
+TEST(ValueQuery, ReturnsPointers) {
+  const auto value = ParseJsonOrDie(R"({"a": [{"b": 1}, {"b": 2}]})");
+  auto plan = ValueQuery::Compile("$.a[*].b");
+  ASSERT_FALSE(plan.err());
+
+  const auto a = value.FindKey("a");
+  ASSERT_NE(a, nullptr);
+  const auto& array = a->GetArray();
+
+  const auto result = plan->Evaluate(value);
+  ASSERT_EQ(result.size(), 2U);
+  EXPECT_EQ(result[0].get(), &array[0].GetObject().cbegin()->second);
+  EXPECT_EQ(result[1].get(), &array[1].GetObject().cbegin()->second);
+}
+
+TEST(ValueQuery, Parallel) {
+  Value value(Value::Type::kObject);
+  auto items = value.SetKey("items", Value(Value::Type::kArray));
+  for (auto i = 0; i < 1000; i++) {
+    Value item(Value::Type::kObject);
+    item.SetKey("id", Value(i));
+    item.SetKey("qty", Value(i % 20));
+    items->GetArray().emplace_back(std::move(item));
+  }
+
+  ThreadPoolTaskRunner task_runner(4, chrono::seconds(60));
+  for (const auto query :
+       {"$.items[?@.qty > 10].id", "$.items[*].id", "$.items[5].id",
+        "$.missing[*]", "$[?@[0].qty == 1]"}) {
+    auto plan = ValueQuery::Compile(query);
+    ASSERT_FALSE(plan.err());
+
+    const auto expected = plan->Evaluate(value);
+    for (size_t parallelism = 1; parallelism <= 8; parallelism++) {
+      const auto result = plan->Evaluate(
+          value, &task_runner, ValueQueryParallelism(parallelism));
+      EXPECT_EQ(result, expected);
+    }
+  }
+}
+
+}  // namespace rst
@@ -30,9 +30,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory_resource>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -44,6 +46,18 @@ namespace {
 constexpr int64_t kMaxSafeInteger =
     (int64_t{1} << std::numeric_limits<double>::digits) - 1;
 
+const Value& At(const Value& value, const std::string_view path) {
+  const auto result = value.FindPath(path);
+  RST_CHECK(result != nullptr);
+  return *result;
+}
+
+Value& At(Value& value, const std::string_view path) {
+  const auto result = value.FindPath(path);
+  RST_CHECK(result != nullptr);
+  return *result;
+}
+
 }  // namespace
 
 TEST(Value, ConstructFromType) {
@@ -214,6 +228,28 @@ TEST(Value, ConstructBigInt) {
   EXPECT_EQ(value.GetInt64(), int64_t{std::numeric_limits<int>::min()} - 1);
 }
 
+TEST(Value, IntegerAndDoubleNumbers) {
+  Value integer(int64_t{-37});
+  Value number(-37.0);
+  EXPECT_EQ(integer.GetDouble(), -37.0);
+  EXPECT_EQ(integer, number);
+  EXPECT_FALSE(integer < number);
+  EXPECT_FALSE(number < integer);
+  EXPECT_LT(integer, Value(-36.5));
+  EXPECT_LT(Value(-37.5), integer);
+  EXPECT_LT(integer, Value(-36));
+
+  Value clone = integer.Clone();
+  EXPECT_EQ(clone.GetInt64(), -37);
+
+  Value moved(std::move(clone));
+  EXPECT_EQ(moved.GetInt64(), -37);
+
+  Value zero(Value::Type::kNumber);
+  EXPECT_EQ(zero.GetInt(), 0);
+  EXPECT_EQ(zero.GetDouble(), 0.0);
+}
+
 TEST(Value, ConstructDouble) {
   Value value(-4.655);
   ASSERT_EQ(value.type(), Value::Type::kNumber);
@@ -243,6 +279,14 @@ TEST(Value, ConstructStringFromStdStringRRef) {
   EXPECT_EQ(value.GetString(), "foobar");
 }
 
+TEST(Value, StdStringInterop) {
+  const std::string str = "foobar";
+  const Value value(str);
+  ASSERT_EQ(value.type(), Value::Type::kString);
+  const std::string copy = value.GetStdString();
+  EXPECT_EQ(copy, str);
+}
+
 TEST(Value, ConstructArray) {
   Value::Array storage;
   storage.emplace_back("foo");
@@ -400,6 +444,129 @@ TEST(Value, CopyObject) {
   EXPECT_EQ(blank, value);
 }
 
+TEST(Value, CloneSharesNodes) {
+  Value value(Value::Type::kObject);
+  value.SetPath("a.b", Value("string"));
+  value.SetKey("c", Value(Value::Type::kArray));
+
+  const Value clone = value.Clone();
+  EXPECT_EQ(&clone.GetObject(), &std::as_const(value).GetObject());
+  EXPECT_EQ(clone.FindPath("a.b"), std::as_const(value).FindPath("a.b"));
+}
+
+TEST(Value, CopyOnWrite) {
+  Value value(Value::Type::kObject);
+  value.SetPath("a.b", Value(1));
+  value.SetPath("a.c", Value("string"));
+  value.SetKey("d", Value(Value::Type::kArray));
+
+  Value clone = value.Clone();
+  clone.SetPath("a.b", Value(2));
+  EXPECT_EQ(At(value, "a.b").GetInt(), 1);
+  EXPECT_EQ(At(clone, "a.b").GetInt(), 2);
+
+  const auto& const_value = std::as_const(value);
+  const auto& const_clone = std::as_const(clone);
+  EXPECT_NE(&const_clone.GetObject(), &const_value.GetObject());
+  EXPECT_NE(&At(const_clone, "a"), &At(const_value, "a"));
+  EXPECT_EQ(&At(const_clone, "a.c").GetString(),
+            &At(const_value, "a.c").GetString());
+  EXPECT_EQ(&At(const_clone, "d").GetArray(), &At(const_value, "d").GetArray());
+
+  At(clone, "d").GetArray().emplace_back(3);
+  EXPECT_TRUE(At(const_value, "d").GetArray().empty());
+  EXPECT_EQ(At(const_clone, "d").GetArray().size(), 1U);
+
+  At(value, "a.c").GetString() += "!";
+  EXPECT_EQ(std::string_view(At(const_value, "a.c").GetString()), "string!");
+  EXPECT_EQ(std::string_view(At(const_clone, "a.c").GetString()), "string");
+}
+
+TEST(Value, CloneToOtherResource) {
+  Value value(Value::Type::kArray);
+  value.GetArray().emplace_back("string");
+
+  std::pmr::monotonic_buffer_resource resource;
+  const Value clone = value.Clone(Value::allocator_type(&resource));
+  EXPECT_EQ(clone, value);
+  EXPECT_NE(&clone.GetArray(), &std::as_const(value).GetArray());
+  EXPECT_EQ(clone.GetArray().get_allocator().resource(), &resource);
+  EXPECT_EQ(clone.GetArray()[0].GetString().get_allocator().resource(),
+            &resource);
+}
+
+TEST(Value, Hash) {
+  EXPECT_EQ(Value().Hash(), Value().Hash());
+  EXPECT_EQ(Value(2).Hash(), Value(2.0).Hash());
+  EXPECT_EQ(Value(0.0).Hash(), Value(-0.0).Hash());
+  EXPECT_NE(Value(2).Hash(), Value(3).Hash());
+  EXPECT_NE(Value(true).Hash(), Value(false).Hash());
+  EXPECT_NE(Value("a").Hash(), Value("b").Hash());
+  EXPECT_NE(Value(Value::Type::kArray).Hash(),
+            Value(Value::Type::kObject).Hash());
+
+  Value value(Value::Type::kObject);
+  value.SetPath("a.b", Value("string"));
+  value.SetKey("c", Value(Value::Type::kArray))->GetArray().emplace_back(1);
+
+  Value other(Value::Type::kObject);
+  other.SetKey("c", Value(Value::Type::kArray))->GetArray().emplace_back(1.0);
+  other.SetPath("a.b", Value("string"));
+
+  const auto hash = value.Hash();
+  EXPECT_EQ(other.Hash(), hash);
+  EXPECT_EQ(std::hash<Value>()(value), hash);
+
+  const Value clone = value.Clone();
+  EXPECT_EQ(clone.Hash(), hash);
+
+  value.SetPath("a.b", Value("other"));
+  EXPECT_NE(value.Hash(), hash);
+  EXPECT_NE(value, other);
+  EXPECT_EQ(clone.Hash(), hash);
+
+  other.SetPath("a.b", Value("other"));
+  EXPECT_EQ(other.Hash(), value.Hash());
+  EXPECT_EQ(other, value);
+
+  std::unordered_set<Value> set;
+  set.emplace(std::move(value));
+  set.emplace(std::move(other));
+  set.emplace(clone.Clone());
+  EXPECT_EQ(set.size(), 2U);
+}
+
+TEST(Value, HashAfterMutationThroughPointer) {
+  Value value(Value::Type::kObject);
+  const auto inner = value.SetKey("k", Value(Value::Type::kObject));
+  const auto hash = value.Hash();
+  inner->SetKey("x", Value(1));
+
+  Value expected(Value::Type::kObject);
+  expected.SetKey("k", Value(Value::Type::kObject))->SetKey("x", Value(1));
+  expected.Hash();
+  EXPECT_EQ(value, expected);
+  EXPECT_NE(value.Hash(), hash);
+  EXPECT_EQ(value.Hash(), expected.Hash());
+}
+
+TEST(Value, CachedHash) {
+  Value value(Value::Type::kObject);
+  value.SetKey("a", Value(Value::Type::kArray))->GetArray().emplace_back(1);
+  auto other = value.Clone();
+  other.SetKey("b", Value("c"));
+
+  const auto hash = value.CachedHash();
+  EXPECT_EQ(hash, value.Hash());
+  EXPECT_EQ(value.Clone().CachedHash(), hash);
+  EXPECT_NE(other.CachedHash(), hash);
+  EXPECT_NE(value, other);
+
+  other.RemoveKey("b");
+  EXPECT_EQ(other.CachedHash(), hash);
+  EXPECT_EQ(value, other);
+}
+
 TEST(Value, MoveBool) {
   Value true_value(true);
   Value moved_true_value(std::move(true_value));
@@ -525,6 +692,29 @@ TEST(Value, MoveAssignObject) {
   EXPECT_EQ(key->GetInt64(), 123);
 }
 
+TEST(Value, MovedFromIsNull) {
+  Value value("foobar");
+  const auto string = &value.GetString();
+  Value moved_value(std::move(value));
+  EXPECT_TRUE(value.IsNull());
+  EXPECT_EQ(&moved_value.GetString(), string);
+
+  Value blank;
+  blank = std::move(moved_value);
+  EXPECT_TRUE(moved_value.IsNull());
+  EXPECT_EQ(&blank.GetString(), string);
+}
+
+TEST(Value, MoveAssignChild) {
+  Value::Array storage;
+  storage.emplace_back("foobar");
+  Value value(std::move(storage));
+
+  value = std::move(value.GetArray().front());
+  ASSERT_EQ(value.type(), Value::Type::kString);
+  EXPECT_EQ(value.GetString(), "foobar");
+}
+
 TEST(Value, FindKey) {
   Value::Object storage;
   storage.emplace("foo", "bar");
@@ -1154,4 +1344,40 @@ TEST(Value, SetPathLevel3) {
   EXPECT_EQ(*const_v, Value(2));
 }
 
+TEST(Value, Path) {
+  const Value::Path path("key1.key2.key3");
+  EXPECT_EQ(path.path(), "key1.key2.key3");
+  EXPECT_EQ(path.keys(), std::vector<std::string>({"key1", "key2", "key3"}));
+
+  const Value::Path single_key("key1");
+  EXPECT_EQ(single_key.keys(), std::vector<std::string>({"key1"}));
+
+  Value object(Value::Type::kObject);
+  EXPECT_EQ(object.FindPath(path), nullptr);
+  EXPECT_EQ(std::as_const(object).FindPath(path), nullptr);
+
+  auto value = object.SetPath(path, Value(1));
+  EXPECT_EQ(*value, Value(1));
+  EXPECT_EQ(object.FindPath("key1.key2.key3"), value);
+
+  auto v = object.FindPath(path);
+  ASSERT_NE(v, nullptr);
+  EXPECT_EQ(*v, Value(1));
+
+  auto const_v = std::as_const(object).FindPath(path);
+  ASSERT_NE(const_v, nullptr);
+  EXPECT_EQ(*const_v, Value(1));
+
+  value = object.SetPath(path, Value(2));
+  EXPECT_EQ(*value, Value(2));
+
+  const_v = std::as_const(object).FindPath(single_key);
+  ASSERT_NE(const_v, nullptr);
+  EXPECT_TRUE(const_v->IsObject());
+
+  EXPECT_EQ(object.FindPath(Value::Path("key1.key2.key4")), nullptr);
+  EXPECT_EQ(object.FindPath(Value::Path("key1.key3.key3")), nullptr);
+  EXPECT_EQ(std::as_const(object).FindPath(Value::Path("key2.key2")), nullptr);
+}
+
 }  // namespace rst
@@ -0,0 +1,70 @@
+// Copyright (c) 2026, Sergey Abbakumov
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RST_VALUE_VALUE_TEST_UTIL_H_
+#define RST_VALUE_VALUE_TEST_UTIL_H_
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include "rst/check/check.h"
+#include "rst/rtti/rtti.h"
+#include "rst/status/status.h"
+#include "rst/status/status_or.h"
+#include "rst/value/json_reader.h"
+#include "rst/value/value.h"
+
+// Helpers shared by the rst/value tests.
+
+namespace rst {
+
+// Parses the |json| and dies if it's malformed.
+inline Value ParseJsonOrDie(const std::string_view json) {
+  auto value = ParseJson(json);
+  RST_CHECK(!value.err());
+  return std::move(*value);
+}
+
+// Returns the offset of the |Error| that the failed |status| holds.
+template <class Error>
+size_t GetErrorOffset(Status status) {
+  RST_CHECK(status.err());
+  const auto error = dyn_cast<Error>(status.GetError());
+  RST_CHECK(error != nullptr);
+  return error->offset();
+}
+
+template <class Error, class T>
+size_t GetErrorOffset(StatusOr<T> result) {
+  RST_CHECK(result.err());
+  return GetErrorOffset<Error>(std::move(result).TakeStatus());
+}
+
+}  // namespace rst
+
+#endif  // RST_VALUE_VALUE_TEST_UTIL_H_